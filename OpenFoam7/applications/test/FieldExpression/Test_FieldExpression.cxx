@@ -0,0 +1,194 @@
+#include <test.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2018 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+Application
+    Test-FieldExpression
+
+Description
+    Tests of the lazy Field expressions (FieldExpression) against the Field
+    operators, including nested expressions of temporary operands whose
+    storage is reused for the result and named expressions which are
+    evaluated more than once.
+
+\*---------------------------------------------------------------------------*/
+
+#include <primitiveFields.hxx>
+#include <FieldExpression.hxx>
+
+namespace tnbLib
+{
+	//- Report the difference between the expression and the Field operators
+	bool check
+	(
+		const word& name,
+		const scalarField& expr,
+		const scalarField& ref
+	)
+	{
+		const bool pass =
+			expr.size() == ref.size()
+		 && (ref.empty() || max(mag(expr - ref)) < small);
+
+		Info << name << " : " << (pass ? "pass" : "FAIL") << endl;
+
+		return pass;
+	}
+
+	//- Return a temporary copy of f
+	tmp<scalarField> tcopy(const scalarField& f)
+	{
+		return tmp<scalarField>(new scalarField(f));
+	}
+}
+
+
+int tnbLib::Test_FieldExpression()
+{
+	const label n = 1000;
+
+	scalarField a(n), b(n), omega(n);
+
+	forAll(a, i)
+	{
+		a[i] = 1 + i;
+		b[i] = 2 - 0.5*i;
+		omega[i] = i % 3 == 0 ? 0 : 0.1*i;
+	}
+
+	bool pass = true;
+
+	{
+		tmp<scalarField> tk(tcopy(a));
+		const scalarField* kPtr = &tk();
+
+		tmp<scalarField> tres = evaluate(2*fieldExpr(tk)/max(omega, small));
+
+		pass = check
+		(
+			"2*fieldExpr(tk)/max(omega, small)",
+			tres(),
+			2*a/max(omega, small)
+		) && pass;
+
+		const bool reused = &tres() == kPtr;
+
+		Info << "    storage of tk reused : " << (reused ? "pass" : "FAIL")
+			<< endl;
+
+		pass = reused && pass;
+	}
+
+	{
+		tmp<scalarField> tk(tcopy(a));
+
+		pass = check
+		(
+			"fieldExpr(tk)*2",
+			evaluate(fieldExpr(tk)*2)(),
+			a*2
+		) && pass;
+	}
+
+	{
+		tmp<scalarField> ta(tcopy(a));
+		tmp<scalarField> tb(tcopy(b));
+
+		pass = check
+		(
+			"sqrt(mag(fieldExpr(ta)*tb)) + exp(-sqr(fieldExpr(tcopy(b))))",
+			evaluate
+			(
+				sqrt(mag(fieldExpr(ta)*tb))
+			  + exp(-sqr(fieldExpr(tcopy(b))))
+			)(),
+			sqrt(mag(a*b)) + exp(-sqr(b))
+		) && pass;
+	}
+
+	{
+		tmp<scalarField> tb(tcopy(b));
+
+		scalarField res(n, 1.0);
+		res += fieldExpr(a)*tb - min(fieldExpr(tcopy(omega)), 0.5);
+
+		pass = check
+		(
+			"res += fieldExpr(a)*tb - min(fieldExpr(tomega), 0.5)",
+			res,
+			1 + a*b - min(omega, 0.5)
+		) && pass;
+	}
+
+	{
+		tmp<scalarField> ta(tcopy(a));
+
+		const scalarField res(fieldExpr(b) - fieldExpr(ta)/magSqr(omega + 1));
+
+		pass = check
+		(
+			"scalarField(fieldExpr(b) - fieldExpr(ta)/magSqr(omega + 1))",
+			res,
+			b - a/magSqr(omega + 1)
+		) && pass;
+	}
+
+	{
+		tmp<scalarField> tk(tcopy(a));
+		const scalarField* kPtr = &tk();
+
+		// A named expression is evaluated into new storage, leaving its
+		// temporary operand for the next evaluation
+		const auto e = fieldExpr(tk)*2;
+
+		const tmp<scalarField> tres1 = evaluate(e);
+		const tmp<scalarField> tres2 = evaluate(e);
+
+		pass = check("evaluate(e) once", tres1(), a*2) && pass;
+		pass = check("evaluate(e) twice", tres2(), a*2) && pass;
+
+		const bool kept = &tres1() != kPtr && &tres2() != kPtr;
+
+		Info << "    storage of tk kept : " << (kept ? "pass" : "FAIL")
+			<< endl;
+
+		pass = kept && pass;
+	}
+
+	{
+		// Expressions of Fields only can be copied and reused as operands
+		const auto e = fieldExpr(a)*b;
+
+		pass = check
+		(
+			"evaluate(e*e + e)",
+			evaluate(e*e + e)(),
+			a*b*a*b + a*b
+		) && pass;
+	}
+
+	Info << nl << (pass ? "All tests passed" : "Tests FAILED") << nl
+		<< "\nEnd\n" << endl;
+
+	return pass ? 0 : 1;
+}
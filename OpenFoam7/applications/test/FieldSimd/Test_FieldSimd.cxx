@@ -0,0 +1,211 @@
+#include <test.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-FieldSimd
+
+Description
+    Micro-benchmark of the explicitly vectorised vector and tensor field
+    kernels (simdFields) against the generic FieldM.H macro loops.
+
+    Each operation is evaluated nRepeat times on random fields of the given
+    size with both implementations. The time per call, the speed-up and the
+    maximum difference between the results are reported.
+
+\*---------------------------------------------------------------------------*/
+
+#include <argList.hxx>
+#include <cpuTime.hxx>
+#include <Random.hxx>
+#include <vectorField.hxx>
+#include <tensorField.hxx>
+#include <transformField.hxx>
+
+namespace tnbLib
+{
+	//- Return the time per call of f
+	template<class Function>
+	scalar timeCalls(const label nRepeat, const Function& f)
+	{
+		cpuTime timer;
+
+		for (label repeati = 0; repeati < nRepeat; repeati++)
+		{
+			f();
+		}
+
+		return timer.cpuTimeIncrement() / nRepeat;
+	}
+
+	//- Report the timings and the difference between the results
+	void reportCalls
+	(
+		const word& operation,
+		const scalar macroTime,
+		const scalar simdTime,
+		const scalar maxDiff
+	)
+	{
+		Info << operation << nl
+			<< "    macro [s] : " << macroTime << nl
+			<< "    simd [s]  : " << simdTime << nl
+			<< "    speed-up  : " << macroTime / max(simdTime, vSmall) << nl
+			<< "    max diff  : " << maxDiff << nl << endl;
+	}
+
+	template<class Type>
+	void reportCalls
+	(
+		const word& operation,
+		const scalar macroTime,
+		const scalar simdTime,
+		const Field<Type>& macroResult,
+		const Field<Type>& simdResult
+	)
+	{
+		reportCalls
+		(
+			operation,
+			macroTime,
+			simdTime,
+			max(mag(simdResult - macroResult))
+		);
+	}
+}
+
+
+void tnbLib::Test_FieldSimd(int argc, char* argv[])
+{
+	argList::noParallel();
+	argList::addOption
+	(
+		"size",
+		"label",
+		"number of elements per field, default 1000000"
+	);
+	argList::addOption
+	(
+		"nRepeat",
+		"label",
+		"number of calls per operation for the timing, default 100"
+	);
+
+	argList args(argc, argv);
+
+	const label n = args.optionLookupOrDefault<label>("size", 1000000);
+	const label nRepeat = args.optionLookupOrDefault<label>("nRepeat", 100);
+
+	Random rndGen(0);
+
+	vectorField va(n), vb(n);
+	tensorField ta(n), tb(n);
+
+	forAll(va, i)
+	{
+		va[i] = rndGen.sample01<vector>();
+		vb[i] = rndGen.sample01<vector>();
+		ta[i] = rndGen.sample01<tensor>();
+		tb[i] = rndGen.sample01<tensor>();
+	}
+
+	Info << "Field size " << n << ", " << nRepeat << " calls per operation"
+		<< nl << endl;
+
+	// The generic implementations are selected by explicit template
+	// arguments, the unqualified calls resolve to the simdFields overloads
+	{
+		scalarField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { dot<vector, vector>(rm, va, vb); });
+		const scalar ts = timeCalls(nRepeat, [&]() { dot(rs, va, vb); });
+		reportCalls("vector & vector", tm, ts, rm, rs);
+	}
+
+	{
+		vectorField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { cross<vector, vector>(rm, va, vb); });
+		const scalar ts = timeCalls(nRepeat, [&]() { cross(rs, va, vb); });
+		reportCalls("vector ^ vector", tm, ts, rm, rs);
+	}
+
+	{
+		scalarField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { magSqr<vector>(rm, va); });
+		const scalar ts = timeCalls(nRepeat, [&]() { magSqr(rs, va); });
+		reportCalls("magSqr(vector)", tm, ts, rm, rs);
+	}
+
+	{
+		vectorField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { dot<tensor, vector>(rm, ta, va); });
+		const scalar ts = timeCalls(nRepeat, [&]() { dot(rs, ta, va); });
+		reportCalls("tensor & vector", tm, ts, rm, rs);
+	}
+
+	{
+		tensorField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { dot<tensor, tensor>(rm, ta, tb); });
+		const scalar ts = timeCalls(nRepeat, [&]() { dot(rs, ta, tb); });
+		reportCalls("tensor & tensor", tm, ts, rm, rs);
+	}
+
+	{
+		scalarField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { dotdot<tensor, tensor>(rm, ta, tb); });
+		const scalar ts = timeCalls(nRepeat, [&]() { dotdot(rs, ta, tb); });
+		reportCalls("tensor && tensor", tm, ts, rm, rs);
+	}
+
+	{
+		vectorField rm(n), rs(n);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { transform<vector>(rm, ta, va); });
+		const scalar ts = timeCalls(nRepeat, [&]() { transform(rs, ta, va); });
+		reportCalls("transform(tensor, vector)", tm, ts, rm, rs);
+	}
+
+	{
+		scalar rm = 0, rs = 0;
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { rm = sumProd<vector>(va, vb); });
+		const scalar ts = timeCalls(nRepeat, [&]() { rs = sumProd(va, vb); });
+		reportCalls("sumProd(vector, vector)", tm, ts, mag(rs - rm));
+	}
+
+	{
+		vectorField rm(vb), rs(vb);
+		const scalar tm =
+			timeCalls(nRepeat, [&]() { axpy<vector>(rm, 1e-3, va); });
+		const scalar ts = timeCalls(nRepeat, [&]() { axpy(rs, 1e-3, va); });
+		reportCalls("axpy(vector)", tm, ts, rm, rs);
+	}
+
+	Info << "End\n" << endl;
+}
@@ -0,0 +1,175 @@
+#include <test.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-SoAField
+
+Description
+    Benchmark of the structure-of-arrays component access (SoAField) on the
+    momentum predictor of simpleFoam.
+
+    The velocity field U is read and the face flux is calculated from it.
+    The time of the per-component extraction (Field::component) and
+    insertion (Field::replace) of the former segregated solution is compared
+    with the single-pass transposition of SoAField for the field and the
+    source, and both are related to the time of the complete momentum
+    predictor
+
+        UEqn = fvm::div(phi, U) - fvm::laplacian(nu, U)
+        solve(UEqn == -grad(p))
+
+    which uses the SoAField path of fvMatrix::solveSegregated.
+
+\*---------------------------------------------------------------------------*/
+
+#include <fvCFD.hxx>
+#include <cpuTime.hxx>
+#include <SoAField.hxx>
+
+int tnbLib::Test_SoAField(int argc, char* argv[])
+{
+	argList::addOption
+	(
+		"nRepeat",
+		"label",
+		"number of repetitions for the timing, default 10"
+	);
+	argList::addOption
+	(
+		"nu",
+		"scalar",
+		"kinematic viscosity, default 1e-5"
+	);
+
+#include <setRootCase.lxx>
+#include <createTime.lxx>
+#include <createMesh.lxx>
+
+	const label nRepeat = args.optionLookupOrDefault<label>("nRepeat", 10);
+
+	const dimensionedScalar nu
+	(
+		"nu",
+		dimViscosity,
+		args.optionLookupOrDefault<scalar>("nu", 1e-5)
+	);
+
+	volVectorField U
+	(
+		IOobject
+		(
+			"U",
+			runTime.timeName(),
+			mesh,
+			IOobject::MUST_READ,
+			IOobject::NO_WRITE
+		),
+		mesh
+	);
+
+	volScalarField p
+	(
+		IOobject
+		(
+			"p",
+			runTime.timeName(),
+			mesh,
+			IOobject::MUST_READ,
+			IOobject::NO_WRITE
+		),
+		mesh
+	);
+
+	const surfaceScalarField phi("phi", fvc::flux(U));
+
+	const vectorField& Ui = U.primitiveField();
+	vectorField UCopy(Ui.size());
+
+	cpuTime timer;
+
+	// Component extraction and insertion of the field and the source as
+	// formerly done per component by fvMatrix::solveSegregated
+	for (label repeati = 0; repeati < nRepeat; repeati++)
+	{
+		for (direction cmpt = 0; cmpt < vector::nComponents; cmpt++)
+		{
+			scalarField psiCmpt(Ui.component(cmpt));
+			scalarField sourceCmpt(Ui.component(cmpt));
+			UCopy.replace(cmpt, psiCmpt);
+		}
+	}
+
+	const scalar componentTime = timer.cpuTimeIncrement() / nRepeat;
+
+	// The same with single-pass transposition
+	for (label repeati = 0; repeati < nRepeat; repeati++)
+	{
+		SoAField<vector> psiCmpts(Ui);
+		SoAField<vector> sourceCmpts(Ui);
+		psiCmpts.scatter(UCopy);
+	}
+
+	const scalar soaTime = timer.cpuTimeIncrement() / nRepeat;
+
+	const scalar maxDiff = max(mag(UCopy - Ui));
+
+	// Momentum predictor
+	const volVectorField U0("U0", U);
+	SolverPerformance<vector> solverPerf;
+
+	for (label repeati = 0; repeati < nRepeat; repeati++)
+	{
+		U == U0;
+
+		fvVectorMatrix UEqn
+		(
+			fvm::div(phi, U)
+			- fvm::laplacian(nu, U)
+		);
+
+		UEqn.relax();
+
+		solverPerf = solve(UEqn == -fvc::grad(p));
+	}
+
+	const scalar predictorTime = timer.cpuTimeIncrement() / nRepeat;
+
+	Info << "Cells " << mesh.nCells() << ", " << nRepeat << " repetitions"
+		<< nl << nl
+		<< "Component access of U and its source" << nl
+		<< "    component/replace [s] : " << componentTime << nl
+		<< "    SoAField [s]          : " << soaTime << nl
+		<< "    speed-up              : "
+		<< componentTime / max(soaTime, vSmall) << nl
+		<< "    max diff              : " << maxDiff << nl << nl
+		<< "Momentum predictor" << nl
+		<< "    time [s]              : " << predictorTime << nl
+		<< "    iterations            : " << solverPerf.nIterations() << nl
+		<< "    saving [%]            : "
+		<< 100 * (componentTime - soaTime) / max(predictorTime, vSmall)
+		<< nl << "\nEnd\n" << endl;
+
+	return 0;
+}
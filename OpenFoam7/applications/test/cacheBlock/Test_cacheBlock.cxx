@@ -0,0 +1,200 @@
+#include <test.hxx>
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+    \\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-cacheBlock
+
+Description
+    Benchmark of the cache-blocked traversal of the internal faces (see
+    lduAddressing::cacheBlockSize) on the face-to-cell loops it is used by.
+
+    fvc::surfaceIntegrate, the Gauss gradient and the linear interpolation
+    are timed on the mesh of the case, first in the original face order and
+    then in the order blocked for the given cache size. The faces are not
+    renumbered, so the blocked order reads the face data indirectly; the
+    switch should only be set if this shows a gain for the mesh.
+
+\*---------------------------------------------------------------------------*/
+
+#include <fvCFD.hxx>
+#include <cpuTime.hxx>
+#include <linear.hxx>
+#include <gaussGrad.hxx>
+
+namespace tnbLib
+{
+	//- Return the time per call of f
+	template<class Function>
+	scalar timeCalls(const label nRepeat, const Function& f)
+	{
+		cpuTime timer;
+
+		for (label repeati = 0; repeati < nRepeat; repeati++)
+		{
+			f();
+		}
+
+		return timer.cpuTimeIncrement() / nRepeat;
+	}
+
+	//- Report the timings of both orders and the difference of the results
+	template<class Type>
+	void reportCalls
+	(
+		const word& operation,
+		const scalar originalTime,
+		const scalar blockedTime,
+		const Field<Type>& originalResult,
+		const Field<Type>& blockedResult
+	)
+	{
+		Info << operation << nl
+			<< "    original [s] : " << originalTime << nl
+			<< "    blocked [s]  : " << blockedTime << nl
+			<< "    speed-up     : "
+			<< originalTime / max(blockedTime, vSmall) << nl
+			<< "    max diff     : "
+			<< max(mag(blockedResult - originalResult)) << nl << endl;
+	}
+}
+
+
+int tnbLib::Test_cacheBlock(int argc, char* argv[])
+{
+	argList::addOption
+	(
+		"cacheBlockSize",
+		"label",
+		"size in bytes of the cache the faces are blocked for, default 262144"
+	);
+	argList::addOption
+	(
+		"nRepeat",
+		"label",
+		"number of calls per operation for the timing, default 100"
+	);
+
+#include <setRootCase.lxx>
+#include <createTime.lxx>
+#include <createMesh.lxx>
+
+	const label blockSize =
+		args.optionLookupOrDefault<label>("cacheBlockSize", 262144);
+	const label nRepeat = args.optionLookupOrDefault<label>("nRepeat", 100);
+
+	const volVectorField U("U", mesh.C());
+	const volScalarField p("p", mag(mesh.C()));
+	const surfaceScalarField phi("phi", mesh.Sf() & linearInterpolate(U));
+
+	// Timings and results in the original [0] and the blocked [1] order
+	scalar integrateTime[2], gradTime[2], interpolateTime[2];
+	scalarField integrateResult[2];
+	vectorField gradResult[2], interpolateResult[2];
+
+	const int blockSizes[2] = {0, int(blockSize)};
+
+	for (label orderi = 0; orderi < 2; orderi++)
+	{
+		lduAddressing::cacheBlockSize = blockSizes[orderi];
+		mesh.lduAddr().clearCacheBlockFaceOrder();
+
+		if (orderi == 1 && mesh.cacheBlockFaceOrder().empty())
+		{
+			Info << "The cells fit in a single block of " << blockSize
+				<< " bytes, the original order is kept" << nl << endl;
+		}
+
+		integrateTime[orderi] = timeCalls
+		(
+			nRepeat,
+			[&]()
+			{
+				integrateResult[orderi] =
+					fvc::surfaceIntegrate(phi)().primitiveField();
+			}
+		);
+
+		gradTime[orderi] = timeCalls
+		(
+			nRepeat,
+			[&]()
+			{
+				gradResult[orderi] = fv::gaussGrad<scalar>::gradf
+				(
+					linearInterpolate(p),
+					"grad(p)"
+				)().primitiveField();
+			}
+		);
+
+		interpolateTime[orderi] = timeCalls
+		(
+			nRepeat,
+			[&]()
+			{
+				interpolateResult[orderi] =
+					linearInterpolate(U)().primitiveField();
+			}
+		);
+	}
+
+	lduAddressing::cacheBlockSize = 0;
+	mesh.lduAddr().clearCacheBlockFaceOrder();
+
+	Info << "Cells " << mesh.nCells() << ", internal faces "
+		<< mesh.nInternalFaces() << ", cache block " << blockSize
+		<< " bytes, " << nRepeat << " calls per operation" << nl << endl;
+
+	reportCalls
+	(
+		"surfaceIntegrate(phi)",
+		integrateTime[0],
+		integrateTime[1],
+		integrateResult[0],
+		integrateResult[1]
+	);
+
+	reportCalls
+	(
+		"gaussGrad(p)",
+		gradTime[0],
+		gradTime[1],
+		gradResult[0],
+		gradResult[1]
+	);
+
+	reportCalls
+	(
+		"linearInterpolate(U)",
+		interpolateTime[0],
+		interpolateTime[1],
+		interpolateResult[0],
+		interpolateResult[1]
+	);
+
+	Info << "End\n" << endl;
+
+	return 0;
+}
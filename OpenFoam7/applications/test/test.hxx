@@ -9,6 +9,8 @@ namespace tnbLib
 
 	void Test_callback();
 
+	int Test_cacheBlock(int argc, char* argv[]);
+
 	void Test_Circulator();
 
 	void Test_CompactIOList(int argc, char *argv[]);
@@ -63,6 +65,10 @@ namespace tnbLib
 
 	int Test_GAMGAgglomeration(int argc, char* argv[]);
 
+	void Test_FieldSimd(int argc, char* argv[]);
+
+	int Test_SoAField(int argc, char* argv[]);
+
 	int Test_globalIndex(int argc, char* argv[]);
 
 	int Test_globalMeshData(int argc, char* argv[]);
@@ -217,6 +223,8 @@ namespace tnbLib
 
 	void Test_tmpField();
 
+	int Test_FieldExpression();
+
 	int Test_tokenize(int argc, char* argv[]);
 
 	void Test_triTet();
@@ -41,6 +41,17 @@ namespace tnbLib
 	DynamicList<MPI_Group> PstreamGlobals::MPIGroups_;
 	//! \endcond
 
+	// Allocated neighbourhood communicators.
+	//! \cond fileScope
+	DynamicList<MPI_Comm> PstreamGlobals::MPINeighbourCommunicators_;
+	//! \endcond
+
+	// Persistent send and receive channels.
+	//! \cond fileScope
+	DynamicList<PstreamGlobals::persistentChannel>
+		PstreamGlobals::persistentChannels_;
+	//! \endcond
+
 	void PstreamGlobals::checkCommunicator
 	(
 		const label comm,
@@ -62,6 +73,154 @@ namespace tnbLib
 	}
 
 
+	void PstreamGlobals::startPersistentChannel
+	(
+		label& channel,
+		const bool send,
+		const int procNo,
+		const char* buf,
+		const std::streamsize bufSize,
+		const int tag,
+		const label comm
+	)
+	{
+		if (channel >= 0)
+		{
+			persistentChannel& pc = persistentChannels_[channel];
+
+			// Complete the previous transfer. Returns immediately if it
+			// has already been waited for through outstandingRequests_.
+			MPI_Wait(&pc.request, MPI_STATUS_IGNORE);
+
+			if
+				(
+					pc.send != send
+					|| pc.procNo != procNo
+					|| pc.buf != buf
+					|| pc.bufSize != bufSize
+					|| pc.tag != tag
+					|| pc.comm != comm
+					)
+			{
+				freePersistentChannel(channel);
+			}
+		}
+
+		if (channel < 0)
+		{
+			// Re-use a freed channel
+			forAll(persistentChannels_, channeli)
+			{
+				if (persistentChannels_[channeli].request == MPI_REQUEST_NULL)
+				{
+					channel = channeli;
+					break;
+				}
+			}
+
+			if (channel < 0)
+			{
+				channel = persistentChannels_.size();
+				persistentChannels_.append(persistentChannel());
+			}
+
+			persistentChannel& pc = persistentChannels_[channel];
+
+			pc.send = send;
+			pc.procNo = procNo;
+			pc.buf = buf;
+			pc.bufSize = bufSize;
+			pc.tag = tag;
+			pc.comm = comm;
+
+			int failed;
+
+			if (send)
+			{
+				failed = MPI_Send_init
+				(
+					const_cast<char*>(buf),
+					bufSize,
+					MPI_BYTE,
+					procNo,
+					tag,
+					MPICommunicators_[comm],
+					&pc.request
+				);
+			}
+			else
+			{
+				failed = MPI_Recv_init
+				(
+					const_cast<char*>(buf),
+					bufSize,
+					MPI_BYTE,
+					procNo,
+					tag,
+					MPICommunicators_[comm],
+					&pc.request
+				);
+			}
+
+			if (failed)
+			{
+				FatalErrorInFunction
+					<< "Cannot create persistent "
+					<< (send ? "send to" : "receive from")
+					<< " processor " << procNo
+					<< abort(FatalError);
+			}
+		}
+
+		persistentChannel& pc = persistentChannels_[channel];
+
+		if (MPI_Start(&pc.request))
+		{
+			FatalErrorInFunction
+				<< "MPI_Start failed for persistent "
+				<< (pc.send ? "send to" : "receive from")
+				<< " processor " << procNo
+				<< abort(FatalError);
+		}
+
+		outstandingRequests_.append(pc.request);
+	}
+
+
+	void PstreamGlobals::freePersistentChannel(label& channel)
+	{
+		if (channel < 0 || channel >= persistentChannels_.size())
+		{
+			channel = -1;
+			return;
+		}
+
+		persistentChannel& pc = persistentChannels_[channel];
+
+		int finalized = 0;
+		MPI_Finalized(&finalized);
+
+		if (pc.request != MPI_REQUEST_NULL && !finalized)
+		{
+			MPI_Wait(&pc.request, MPI_STATUS_IGNORE);
+
+			// Remove the copies of the request which have not been waited for
+			forAll(outstandingRequests_, i)
+			{
+				if (outstandingRequests_[i] == pc.request)
+				{
+					outstandingRequests_[i] = MPI_REQUEST_NULL;
+				}
+			}
+
+			// Sets the request to MPI_REQUEST_NULL
+			MPI_Request_free(&pc.request);
+		}
+
+		channel = -1;
+	}
+
+
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace tnbLib
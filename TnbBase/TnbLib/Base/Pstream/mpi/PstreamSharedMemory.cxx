@@ -0,0 +1,589 @@
+#include <PstreamSharedMemory.hxx>
+
+#include <PstreamGlobals.hxx>
+#include <UPstream.hxx>
+#include <labelList.hxx>
+#include <error.hxx>
+#include <IOstreams.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+
+// * * * * * * * * * * * * * * * * Local Data * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	namespace PstreamSharedMemory
+	{
+		//- Size of the ring of a mailbox in units of its first message,
+		//  leaving room for larger messages with the same tag, e.g. of
+		//  tensor after scalar fields
+		static const int64_t ringMessages = 16;
+
+		//- Maximum number of mailboxes of a segment
+		static const int maxMailboxes = 1024;
+
+		//- Alignment of the messages
+		static const int64_t slotAlignment = 64;
+
+		//- Message index from which a mailbox using shared memory throughout
+		//  would send by MPI
+		static const uint64_t neverMPI = UINT64_MAX;
+
+		//- Messages from the owner of a segment to one receiver with a
+		//  given tag and communicator, held in a ring of bytes. The fields
+		//  other than the counts and positions are set before the mailbox is
+		//  published and not changed afterwards
+		struct mailbox
+		{
+			int32_t toRank;
+			int32_t tag;
+			int32_t comm;
+			int64_t offset;
+			int64_t ringSize;
+
+			//- Position after the last message written, only accessed by
+			//  the owner
+			int64_t writePos;
+
+			//- Number of messages written, incremented by the owner
+			std::atomic<uint64_t> nSent;
+
+			//- Index of the first message sent by MPI, set once by the
+			//  owner. All later messages are sent by MPI as well
+			std::atomic<uint64_t> mpiFrom;
+
+			//- Number of messages read, only accessed by the receiver
+			uint64_t nReceived;
+
+			//- Position after the last message read, advanced by the
+			//  receiver
+			std::atomic<int64_t> readPos;
+		};
+
+		//- Start of a segment, followed by the mailboxes and the rings
+		struct segmentHeader
+		{
+			//- Number of published mailboxes
+			std::atomic<int32_t> nMailboxes;
+
+			//- Set by the owner once no more mailboxes can be created
+			std::atomic<int32_t> full;
+
+			//- Bytes of the segment in use, only accessed by the owner
+			int64_t used;
+		};
+
+		static_assert
+		(
+			std::atomic<uint64_t>::is_always_lock_free
+		 && std::atomic<int64_t>::is_always_lock_free
+		 && std::atomic<int32_t>::is_always_lock_free,
+			"shared-memory transfers require lock-free atomics"
+		);
+
+		static MPI_Comm nodeComm_ = MPI_COMM_NULL;
+
+		static MPI_Group nodeGroup_ = MPI_GROUP_NULL;
+
+		static MPI_Win window_ = MPI_WIN_NULL;
+
+		static int myNodeRank_ = -1;
+
+		static int64_t segmentSize_ = 0;
+
+		//- Start of the segment of each rank of the node
+		static List<char*> segments_;
+
+		//- Node rank of each processor, per communicator
+		static DynamicList<labelList> nodeRanks_;
+
+
+		// * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * //
+
+		static int64_t alignedSize(const int64_t size)
+		{
+			return slotAlignment*((size + slotAlignment - 1)/slotAlignment);
+		}
+
+		static int64_t directorySize()
+		{
+			return alignedSize
+			(
+				sizeof(segmentHeader) + maxMailboxes*sizeof(mailbox)
+			);
+		}
+
+		static segmentHeader& header(const int rank)
+		{
+			return *reinterpret_cast<segmentHeader*>(segments_[rank]);
+		}
+
+		static mailbox* mailboxes(const int rank)
+		{
+			return reinterpret_cast<mailbox*>
+			(
+				segments_[rank] + sizeof(segmentHeader)
+			);
+		}
+
+		//- Return the position of a message of the given aligned size
+		//  written or read after pos, wrapping to the start of the ring if
+		//  the message does not fit before its end
+		static int64_t messagePos
+		(
+			const mailbox& box,
+			const int64_t pos,
+			const int64_t size
+		)
+		{
+			const int64_t ringPos = pos % box.ringSize;
+
+			return ringPos + size > box.ringSize
+				? pos + box.ringSize - ringPos
+				: pos;
+		}
+
+		//- Return the published mailbox of the segment of fromRank for the
+		//  given receiver, tag and communicator, nullptr if there is none
+		static mailbox* findMailbox
+		(
+			const int fromRank,
+			const int toRank,
+			const int tag,
+			const label comm
+		)
+		{
+			const int32_t n =
+				header(fromRank).nMailboxes.load(std::memory_order_acquire);
+
+			mailbox* boxes = mailboxes(fromRank);
+
+			for (int32_t boxi = 0; boxi < n; boxi++)
+			{
+				const mailbox& box = boxes[boxi];
+
+				if (box.toRank == toRank && box.tag == tag && box.comm == comm)
+				{
+					return &boxes[boxi];
+				}
+			}
+
+			return nullptr;
+		}
+
+		//- Create and publish a mailbox in the own segment with a ring sized
+		//  for the given first message. Returns nullptr and marks the
+		//  segment full if the directory is exhausted
+		static mailbox* createMailbox
+		(
+			const int toRank,
+			const int tag,
+			const label comm,
+			const int64_t bufSize
+		)
+		{
+			segmentHeader& hdr = header(myNodeRank_);
+
+			const int32_t n = hdr.nMailboxes.load(std::memory_order_relaxed);
+
+			if (n == maxMailboxes)
+			{
+				if (!hdr.full.load(std::memory_order_relaxed))
+				{
+					if (UPstream::debug)
+					{
+						Pout << "PstreamSharedMemory : all " << maxMailboxes
+							<< " mailboxes in use, sending new messages by MPI"
+							<< endl;
+					}
+
+					hdr.full.store(1, std::memory_order_release);
+				}
+
+				return nullptr;
+			}
+
+			mailbox& box = *new(&mailboxes(myNodeRank_)[n]) mailbox;
+
+			box.toRank = toRank;
+			box.tag = tag;
+			box.comm = comm;
+			box.writePos = 0;
+			box.nSent.store(0, std::memory_order_relaxed);
+			box.nReceived = 0;
+			box.readPos.store(0, std::memory_order_relaxed);
+
+			// Take the remaining space if the full ring does not fit
+			box.ringSize = std::min
+			(
+				ringMessages*alignedSize(bufSize),
+				slotAlignment*((segmentSize_ - hdr.used)/slotAlignment)
+			);
+
+			if (box.ringSize >= alignedSize(bufSize))
+			{
+				box.offset = hdr.used;
+				box.mpiFrom.store(neverMPI, std::memory_order_relaxed);
+				hdr.used += box.ringSize;
+			}
+			else
+			{
+				box.offset = -1;
+				box.ringSize = 0;
+				box.mpiFrom.store(0, std::memory_order_relaxed);
+
+				if (UPstream::debug)
+				{
+					Pout << "PstreamSharedMemory : no space for messages of "
+						<< bufSize << " bytes to node rank " << toRank
+						<< ", using MPI" << endl;
+				}
+			}
+
+			hdr.nMailboxes.store(n + 1, std::memory_order_release);
+
+			return &box;
+		}
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+void tnbLib::PstreamSharedMemory::allocate(const label segmentSize)
+{
+	if (segmentSize <= directorySize())
+	{
+		WarningInFunction
+			<< "sharedMemoryBufferSize " << segmentSize
+			<< " is not larger than the " << directorySize()
+			<< " bytes of the mailbox directory." << nl
+			<< "    Shared-memory transfers are disabled" << endl;
+
+		return;
+	}
+
+	MPI_Comm_split_type
+	(
+		PstreamGlobals::MPI_COMM_FOAM,
+		MPI_COMM_TYPE_SHARED,
+		0,
+		MPI_INFO_NULL,
+		&nodeComm_
+	);
+
+	int nNodeProcs;
+	MPI_Comm_size(nodeComm_, &nNodeProcs);
+
+	if (nNodeProcs == 1)
+	{
+		MPI_Comm_free(&nodeComm_);
+		return;
+	}
+
+	MPI_Comm_rank(nodeComm_, &myNodeRank_);
+	MPI_Comm_group(nodeComm_, &nodeGroup_);
+
+	char* base = nullptr;
+
+	if
+	(
+		MPI_Win_allocate_shared
+		(
+			segmentSize,
+			1,
+			MPI_INFO_NULL,
+			nodeComm_,
+			&base,
+			&window_
+		)
+	)
+	{
+		FatalErrorInFunction
+			<< "MPI_Win_allocate_shared failed for a segment of "
+			<< segmentSize << " bytes"
+			<< tnbLib::abort(FatalError);
+	}
+
+	segments_.setSize(nNodeProcs);
+
+	forAll(segments_, rank)
+	{
+		MPI_Aint size;
+		int dispUnit;
+		MPI_Win_shared_query(window_, rank, &size, &dispUnit, &segments_[rank]);
+	}
+
+	segmentSize_ = segmentSize;
+
+	// Initialise the own segment before the others can look at it
+	segmentHeader& hdr = *new(base) segmentHeader;
+	hdr.nMailboxes.store(0, std::memory_order_relaxed);
+	hdr.full.store(0, std::memory_order_relaxed);
+	hdr.used = directorySize();
+
+	MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+	MPI_Barrier(nodeComm_);
+
+	if (UPstream::debug)
+	{
+		Pout << "PstreamSharedMemory::allocate : node rank " << myNodeRank_
+			<< " of " << nNodeProcs << ", segment size " << segmentSize
+			<< endl;
+	}
+}
+
+
+void tnbLib::PstreamSharedMemory::free()
+{
+	if (window_ != MPI_WIN_NULL)
+	{
+		MPI_Win_unlock_all(window_);
+		MPI_Win_free(&window_);
+	}
+
+	if (nodeGroup_ != MPI_GROUP_NULL)
+	{
+		MPI_Group_free(&nodeGroup_);
+	}
+
+	if (nodeComm_ != MPI_COMM_NULL)
+	{
+		MPI_Comm_free(&nodeComm_);
+	}
+
+	myNodeRank_ = -1;
+	segmentSize_ = 0;
+	segments_.clear();
+	nodeRanks_.clear();
+}
+
+
+void tnbLib::PstreamSharedMemory::freeCommunicator(const label communicator)
+{
+	if (communicator < nodeRanks_.size())
+	{
+		nodeRanks_[communicator].clear();
+	}
+}
+
+
+int tnbLib::PstreamSharedMemory::nodeRank
+(
+	const int procNo,
+	const label communicator
+)
+{
+	if (window_ == MPI_WIN_NULL)
+	{
+		return -1;
+	}
+
+	if (communicator >= nodeRanks_.size())
+	{
+		nodeRanks_.setSize(communicator + 1);
+	}
+
+	labelList& ranks = nodeRanks_[communicator];
+
+	if (ranks.empty())
+	{
+		const int nProcs = UPstream::nProcs(communicator);
+
+		List<int> procs(nProcs);
+		List<int> nodeProcs(nProcs);
+
+		forAll(procs, proci)
+		{
+			procs[proci] = proci;
+		}
+
+		MPI_Group group;
+		MPI_Comm_group
+		(
+			PstreamGlobals::MPICommunicators_[communicator],
+			&group
+		);
+		MPI_Group_translate_ranks
+		(
+			group,
+			nProcs,
+			procs.begin(),
+			nodeGroup_,
+			nodeProcs.begin()
+		);
+		MPI_Group_free(&group);
+
+		ranks.setSize(nProcs);
+
+		forAll(ranks, proci)
+		{
+			ranks[proci] =
+			(
+				nodeProcs[proci] == MPI_UNDEFINED
+			 || nodeProcs[proci] == myNodeRank_
+			)
+			? -1
+			: nodeProcs[proci];
+		}
+	}
+
+	return ranks[procNo];
+}
+
+
+bool tnbLib::PstreamSharedMemory::write
+(
+	const int toProcNo,
+	const char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	const int toRank = nodeRank(toProcNo, communicator);
+
+	if (toRank < 0)
+	{
+		return false;
+	}
+
+	mailbox* boxPtr = findMailbox(myNodeRank_, toRank, tag, communicator);
+
+	if (!boxPtr)
+	{
+		boxPtr = createMailbox(toRank, tag, communicator, bufSize);
+
+		if (!boxPtr)
+		{
+			return false;
+		}
+	}
+
+	mailbox& box = *boxPtr;
+
+	const uint64_t nSent = box.nSent.load(std::memory_order_relaxed);
+
+	if (nSent >= box.mpiFrom.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	const int64_t size = alignedSize(bufSize);
+	const int64_t pos = messagePos(box, box.writePos, size);
+
+	// Rather than wait for the receiver to free space, which MPI would not
+	// do for a buffered or non-blocking send and could deadlock ranks
+	// sending to each other, switch the mailbox to MPI from this message on
+	if
+	(
+		size > box.ringSize
+	 || pos + size - box.readPos.load(std::memory_order_acquire)
+		> box.ringSize
+	)
+	{
+		if (UPstream::debug)
+		{
+			Pout << "PstreamSharedMemory : no space for a message of "
+				<< bufSize << " bytes to node rank " << toRank
+				<< ", using MPI from message " << nSent << endl;
+		}
+
+		box.mpiFrom.store(nSent, std::memory_order_release);
+
+		return false;
+	}
+
+	memcpy
+	(
+		segments_[myNodeRank_] + box.offset + pos % box.ringSize,
+		buf,
+		bufSize
+	);
+
+	box.writePos = pos + size;
+	box.nSent.store(nSent + 1, std::memory_order_release);
+
+	return true;
+}
+
+
+bool tnbLib::PstreamSharedMemory::read
+(
+	const int fromProcNo,
+	char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	const int fromRank = nodeRank(fromProcNo, communicator);
+
+	if (fromRank < 0)
+	{
+		return false;
+	}
+
+	// Wait for the sender to publish the mailbox or to run out of
+	// mailboxes, after which all of its mailboxes are visible
+	mailbox* boxPtr = nullptr;
+
+	for (;;)
+	{
+		const bool full =
+			header(fromRank).full.load(std::memory_order_acquire);
+
+		boxPtr = findMailbox(fromRank, myNodeRank_, tag, communicator);
+
+		if (boxPtr || full)
+		{
+			break;
+		}
+
+		std::this_thread::yield();
+	}
+
+	if (!boxPtr)
+	{
+		return false;
+	}
+
+	mailbox& box = *boxPtr;
+
+	const uint64_t nReceived = box.nReceived;
+
+	// Wait for the sender to write the message or to send it by MPI
+	while (box.nSent.load(std::memory_order_acquire) == nReceived)
+	{
+		if (box.mpiFrom.load(std::memory_order_acquire) <= nReceived)
+		{
+			return false;
+		}
+
+		std::this_thread::yield();
+	}
+
+	const int64_t size = alignedSize(bufSize);
+	const int64_t pos =
+		messagePos(box, box.readPos.load(std::memory_order_relaxed), size);
+
+	memcpy
+	(
+		buf,
+		segments_[fromRank] + box.offset + pos % box.ringSize,
+		bufSize
+	);
+
+	box.nReceived = nReceived + 1;
+	box.readPos.store(pos + size, std::memory_order_release);
+
+	return true;
+}
+
+
+// ************************************************************************* //
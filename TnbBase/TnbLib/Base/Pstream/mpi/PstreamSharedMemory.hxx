@@ -0,0 +1,123 @@
+#pragma once
+#ifndef _PstreamSharedMemory_Header
+#define _PstreamSharedMemory_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2013-2018 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Namespace
+	tnbLib::PstreamSharedMemory
+
+Description
+	Transfers between ranks on the same node through an MPI-3 shared-memory
+	window (MPI_Win_allocate_shared).
+
+	Every rank owns a segment of the window holding its outgoing messages.
+	The segment starts with a directory of mailboxes, one per receiver, tag
+	and communicator, each followed by a ring of bytes sized for several
+	messages of the size of its first one. The sender copies the message
+	into the ring after the previous one and increments the send count of
+	the mailbox; the receiver, which knows the size of the message, waits
+	for the count, copies the message straight out of the sender's segment
+	and advances its read position, which frees the space. Messages of a
+	mailbox are therefore received in the order they were sent, as for
+	MPI point-to-point transfers with the same tag.
+
+	Unlike a buffered or non-blocking MPI send, which would not wait for
+	the receiver, write() never waits for space in the ring. If the message
+	does not fit, because it is too large or earlier messages have not been
+	read yet, the mailbox is switched to MPI from this message on. A
+	mailbox which does not fit into the segment of the sender is switched
+	to MPI from the start, and once the directory is exhausted the messages
+	to further receivers, tags and communicators are sent by MPI. In all
+	these cases write() and read() return false for the same messages and
+	the caller transfers them by MPI instead.
+
+SourceFiles
+	PstreamSharedMemory.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <label.hxx>
+
+#include <ios>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+						Namespace PstreamSharedMemory Declaration
+	\*---------------------------------------------------------------------------*/
+
+	namespace PstreamSharedMemory
+	{
+		//- Allocate the shared-memory window of the ranks on this node, with
+		//  a segment of the given size in bytes per rank. Collective over
+		//  all ranks
+		FoamBase_EXPORT void allocate(const label segmentSize);
+
+		//- Free the shared-memory window. Collective over all ranks
+		FoamBase_EXPORT void free();
+
+		//- Forget the node ranks cached for the given communicator
+		FoamBase_EXPORT void freeCommunicator(const label communicator);
+
+		//- Return the rank in the node of the given processor of the given
+		//  communicator, -1 if it is on another node, is this processor or
+		//  if there is no shared-memory window
+		FoamBase_EXPORT int nodeRank(const int procNo, const label communicator);
+
+		//- Copy the message into the mailbox for the given processor.
+		//  Returns false if the message has to be sent by MPI
+		FoamBase_EXPORT bool write
+		(
+			const int toProcNo,
+			const char* buf,
+			const std::streamsize bufSize,
+			const int tag,
+			const label communicator
+		);
+
+		//- Copy the next message from the mailbox of the given processor,
+		//  waiting for it to be written. Returns false if the message has to
+		//  be received by MPI
+		FoamBase_EXPORT bool read
+		(
+			const int fromProcNo,
+			char* buf,
+			const std::streamsize bufSize,
+			const int tag,
+			const label communicator
+		);
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_PstreamSharedMemory_Header
@@ -28,6 +28,7 @@ Description
 
 #include <UIPstream.hxx>
 #include <PstreamGlobals.hxx>
+#include <PstreamSharedMemory.hxx>
 #include <IOstreams.hxx>
 
 #include <mpi.h>
@@ -356,4 +357,86 @@ tnbLib::label tnbLib::UIPstream::read
 }
 
 
-// ************************************************************************* //
\ No newline at end of file
+tnbLib::label tnbLib::UIPstream::read
+(
+	label& channel,
+	const int fromProcNo,
+	char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	if (!UPstream::persistentRequests)
+	{
+		return read
+		(
+			commsTypes::nonBlocking,
+			fromProcNo,
+			buf,
+			bufSize,
+			tag,
+			communicator
+		);
+	}
+
+	if (debug)
+	{
+		Pout << "UIPstream::read : starting persistent read from:"
+			<< fromProcNo
+			<< " tag:" << tag << " comm:" << communicator
+			<< " wanted size:" << label(bufSize)
+			<< " channel:" << channel
+			<< " request:" << PstreamGlobals::outstandingRequests_.size()
+			<< tnbLib::endl;
+	}
+
+	PstreamGlobals::checkCommunicator(communicator, fromProcNo);
+
+	PstreamGlobals::startPersistentChannel
+	(
+		channel,
+		false,
+		fromProcNo,
+		buf,
+		bufSize,
+		tag,
+		communicator
+	);
+
+	// Assume the message is completely received.
+	return bufSize;
+}
+
+
+bool tnbLib::UIPstream::readShared
+(
+	const int fromProcNo,
+	char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	const bool shared = PstreamSharedMemory::read
+	(
+		fromProcNo,
+		buf,
+		bufSize,
+		tag,
+		communicator
+	);
+
+	if (debug && shared)
+	{
+		Pout << "UIPstream::readShared : read from:" << fromProcNo
+			<< " tag:" << tag
+			<< " comm:" << communicator << " size:" << label(bufSize)
+			<< tnbLib::endl;
+	}
+
+	return shared;
+}
+
+
+// ************************************************************************* //
@@ -28,6 +28,7 @@ Description
 
 #include <UOPstream.hxx>
 #include <PstreamGlobals.hxx>
+#include <PstreamSharedMemory.hxx>
 
 #include <IOstreams.hxx>  // added by amir
 
@@ -148,4 +149,84 @@ bool tnbLib::UOPstream::write
 }
 
 
-// ************************************************************************* //
\ No newline at end of file
+bool tnbLib::UOPstream::write
+(
+	label& channel,
+	const int toProcNo,
+	const char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	if (!UPstream::persistentRequests)
+	{
+		return write
+		(
+			commsTypes::nonBlocking,
+			toProcNo,
+			buf,
+			bufSize,
+			tag,
+			communicator
+		);
+	}
+
+	if (debug)
+	{
+		Pout << "UOPstream::write : starting persistent write to:" << toProcNo
+			<< " tag:" << tag
+			<< " comm:" << communicator << " size:" << label(bufSize)
+			<< " channel:" << channel
+			<< " request:" << PstreamGlobals::outstandingRequests_.size()
+			<< tnbLib::endl;
+	}
+
+	PstreamGlobals::checkCommunicator(communicator, toProcNo);
+
+	PstreamGlobals::startPersistentChannel
+	(
+		channel,
+		true,
+		toProcNo,
+		buf,
+		bufSize,
+		tag,
+		communicator
+	);
+
+	return true;
+}
+
+
+bool tnbLib::UOPstream::writeShared
+(
+	const int toProcNo,
+	const char* buf,
+	const std::streamsize bufSize,
+	const int tag,
+	const label communicator
+)
+{
+	const bool shared = PstreamSharedMemory::write
+	(
+		toProcNo,
+		buf,
+		bufSize,
+		tag,
+		communicator
+	);
+
+	if (debug && shared)
+	{
+		Pout << "UOPstream::writeShared : wrote to:" << toProcNo
+			<< " tag:" << tag
+			<< " comm:" << communicator << " size:" << label(bufSize)
+			<< tnbLib::endl;
+	}
+
+	return shared;
+}
+
+
+// ************************************************************************* //
@@ -31,6 +31,7 @@ Note
 #include <PstreamReduceOps.hxx>
 #include <OSspecific.hxx>
 #include <PstreamGlobals.hxx>
+#include <PstreamSharedMemory.hxx>
 #include <SubList.hxx>
 #include <allReduce.hxx>
 
@@ -119,6 +120,11 @@ bool tnbLib::UPstream::init(int& argc, char**& argv, const bool needsThread)
 	// Initialise parallel structure
 	setParRun(numprocs, provided_thread_support == MPI_THREAD_MULTIPLE);
 
+	if (sharedMemoryBufferSize > 0)
+	{
+		PstreamSharedMemory::allocate(sharedMemoryBufferSize);
+	}
+
 #ifndef SGIMPI
 	string bufferSizeName = getEnv("MPI_BUFFER_SIZE");
 
@@ -178,6 +184,24 @@ void tnbLib::UPstream::exit(int errnum)
 			<< endl;
 	}
 
+	// Free the persistent channels without waiting for their transfers
+	forAll(PstreamGlobals::persistentChannels_, channeli)
+	{
+		MPI_Request& request =
+			PstreamGlobals::persistentChannels_[channeli].request;
+
+		if (request != MPI_REQUEST_NULL)
+		{
+			MPI_Request_free(&request);
+		}
+	}
+
+	// The shared-memory window is freed collectively
+	if (errnum == 0)
+	{
+		PstreamSharedMemory::free();
+	}
+
 	// Clean mpi communicators
 	forAll(myProcNo_, communicator)
 	{
@@ -187,6 +211,11 @@ void tnbLib::UPstream::exit(int errnum)
 		}
 	}
 
+	forAll(PstreamGlobals::MPINeighbourCommunicators_, communicator)
+	{
+		freeNeighbourCommunicator(communicator);
+	}
+
 	if (errnum == 0)
 	{
 		MPI_Finalize();
@@ -328,6 +357,114 @@ void tnbLib::reduce
 }
 
 
+void tnbLib::reduce
+(
+	scalar* Value,
+	const int size,
+	const sumOp<scalar>& bop,
+	const int tag,
+	const label communicator,
+	label& requestID
+)
+{
+	if (UPstream::warnComm != -1 && communicator != UPstream::warnComm)
+	{
+		Pout << "** non-blocking reducing:"
+			<< UList<scalar>(Value, size)
+			<< " with comm:" << communicator
+			<< " warnComm:" << UPstream::warnComm
+			<< endl;
+		error::printStack(Pout);
+	}
+
+	MPI_Request request;
+
+	if
+		(
+			MPI_Iallreduce
+			(
+				MPI_IN_PLACE,
+				Value,
+				size,
+				MPI_SCALAR,
+				MPI_SUM,
+				PstreamGlobals::MPICommunicators_[communicator],
+				&request
+			)
+			)
+	{
+		FatalErrorInFunction
+			<< "MPI_Iallreduce failed for "
+			<< UList<scalar>(Value, size)
+			<< tnbLib::abort(FatalError);
+	}
+
+	requestID = PstreamGlobals::outstandingRequests_.size();
+	PstreamGlobals::outstandingRequests_.append(request);
+
+	if (UPstream::debug)
+	{
+		Pout << "UPstream::allocateRequest for non-blocking reduce"
+			<< " : request:" << requestID
+			<< endl;
+	}
+}
+
+
+void tnbLib::reduce
+(
+	scalar* Value,
+	const int size,
+	const minOp<scalar>& bop,
+	const int tag,
+	const label communicator,
+	label& requestID
+)
+{
+	if (UPstream::warnComm != -1 && communicator != UPstream::warnComm)
+	{
+		Pout << "** non-blocking reducing:"
+			<< UList<scalar>(Value, size)
+			<< " with comm:" << communicator
+			<< " warnComm:" << UPstream::warnComm
+			<< endl;
+		error::printStack(Pout);
+	}
+
+	MPI_Request request;
+
+	if
+		(
+			MPI_Iallreduce
+			(
+				MPI_IN_PLACE,
+				Value,
+				size,
+				MPI_SCALAR,
+				MPI_MIN,
+				PstreamGlobals::MPICommunicators_[communicator],
+				&request
+			)
+			)
+	{
+		FatalErrorInFunction
+			<< "MPI_Iallreduce failed for "
+			<< UList<scalar>(Value, size)
+			<< tnbLib::abort(FatalError);
+	}
+
+	requestID = PstreamGlobals::outstandingRequests_.size();
+	PstreamGlobals::outstandingRequests_.append(request);
+
+	if (UPstream::debug)
+	{
+		Pout << "UPstream::allocateRequest for non-blocking reduce"
+			<< " : request:" << requestID
+			<< endl;
+	}
+}
+
+
 void tnbLib::UPstream::allToAll
 (
 	const labelUList& sendData,
@@ -448,6 +585,79 @@ void tnbLib::UPstream::allToAll
 }
 
 
+void tnbLib::UPstream::neighbourAllToAll
+(
+	const char* sendData,
+	const UList<int>& sendSizes,
+	const UList<int>& sendOffsets,
+
+	char* recvData,
+	const UList<int>& recvSizes,
+	const UList<int>& recvOffsets,
+
+	const label neighbourCommunicator
+)
+{
+	if
+		(
+			neighbourCommunicator < 0
+			|| neighbourCommunicator
+			>= PstreamGlobals::MPINeighbourCommunicators_.size()
+			|| PstreamGlobals::MPINeighbourCommunicators_
+			[
+				neighbourCommunicator
+			] == MPI_COMM_NULL
+			)
+	{
+		FatalErrorInFunction
+			<< "Illegal neighbourhood communicator " << neighbourCommunicator
+			<< tnbLib::abort(FatalError);
+	}
+
+	if
+		(
+			sendSizes.size() != sendOffsets.size()
+			|| recvSizes.size() != recvOffsets.size()
+			|| sendSizes.size() != recvSizes.size()
+			)
+	{
+		FatalErrorInFunction
+			<< "Size of sendSize " << sendSizes.size()
+			<< ", sendOffsets " << sendOffsets.size()
+			<< ", recvSizes " << recvSizes.size()
+			<< " and recvOffsets " << recvOffsets.size()
+			<< " differ"
+			<< tnbLib::abort(FatalError);
+	}
+
+	if
+		(
+			MPI_Neighbor_alltoallv
+			(
+				const_cast<char*>(sendData),
+				const_cast<int*>(sendSizes.begin()),
+				const_cast<int*>(sendOffsets.begin()),
+				MPI_BYTE,
+				recvData,
+				const_cast<int*>(recvSizes.begin()),
+				const_cast<int*>(recvOffsets.begin()),
+				MPI_BYTE,
+				PstreamGlobals::MPINeighbourCommunicators_
+				[
+					neighbourCommunicator
+				]
+			)
+			)
+	{
+		FatalErrorInFunction
+			<< "MPI_Neighbor_alltoallv failed for sendSizes " << sendSizes
+			<< " recvSizes " << recvSizes
+			<< " neighbourhood communicator " << neighbourCommunicator
+			<< tnbLib::abort(FatalError);
+	}
+}
+
+
 void tnbLib::UPstream::gather
 (
 	const char* sendData,
@@ -675,6 +885,8 @@ void tnbLib::UPstream::allocatePstreamCommunicator
 
 void tnbLib::UPstream::freePstreamCommunicator(const label communicator)
 {
+	PstreamSharedMemory::freeCommunicator(communicator);
+
 	if (communicator != UPstream::worldComm)
 	{
 		if (PstreamGlobals::MPICommunicators_[communicator] != MPI_COMM_NULL)
@@ -691,6 +903,114 @@ void tnbLib::UPstream::freePstreamCommunicator(const label communicator)
 }
 
 
+bool tnbLib::UPstream::sharedMemoryPeer
+(
+	const int procNo,
+	const label communicator
+)
+{
+	return PstreamSharedMemory::nodeRank(procNo, communicator) >= 0;
+}
+
+
+tnbLib::label tnbLib::UPstream::allocateNeighbourCommunicator
+(
+	const labelUList& neighbourProcs,
+	const label communicator
+)
+{
+	if (!UPstream::parRun())
+	{
+		return -1;
+	}
+
+	PstreamGlobals::checkCommunicator(communicator, 0);
+
+	List<int> neighbours(neighbourProcs.size());
+	forAll(neighbourProcs, i)
+	{
+		neighbours[i] = neighbourProcs[i];
+	}
+
+	MPI_Comm graphComm = MPI_COMM_NULL;
+
+	// Sources and destinations are the same. Do not reorder the ranks so
+	// that the processor numbering of the communicator is kept.
+	if
+		(
+			MPI_Dist_graph_create_adjacent
+			(
+				PstreamGlobals::MPICommunicators_[communicator],
+				neighbours.size(),
+				neighbours.begin(),
+				MPI_UNWEIGHTED,
+				neighbours.size(),
+				neighbours.begin(),
+				MPI_UNWEIGHTED,
+				MPI_INFO_NULL,
+				0,
+				&graphComm
+			)
+			)
+	{
+		FatalErrorInFunction
+			<< "MPI_Dist_graph_create_adjacent failed for neighbours "
+			<< neighbourProcs << " of communicator " << communicator
+			<< tnbLib::abort(FatalError);
+	}
+
+	// Re-use a freed slot
+	forAll(PstreamGlobals::MPINeighbourCommunicators_, index)
+	{
+		if (PstreamGlobals::MPINeighbourCommunicators_[index] == MPI_COMM_NULL)
+		{
+			PstreamGlobals::MPINeighbourCommunicators_[index] = graphComm;
+			return index;
+		}
+	}
+
+	PstreamGlobals::MPINeighbourCommunicators_.append(graphComm);
+
+	if (debug)
+	{
+		Pout << "UPstream::allocateNeighbourCommunicator : neighbours "
+			<< neighbourProcs << " index "
+			<< PstreamGlobals::MPINeighbourCommunicators_.size() - 1 << endl;
+	}
+
+	return PstreamGlobals::MPINeighbourCommunicators_.size() - 1;
+}
+
+
+void tnbLib::UPstream::freeNeighbourCommunicator
+(
+	const label neighbourCommunicator
+)
+{
+	if
+		(
+			neighbourCommunicator < 0
+			|| neighbourCommunicator
+			>= PstreamGlobals::MPINeighbourCommunicators_.size()
+			)
+	{
+		return;
+	}
+
+	MPI_Comm& graphComm =
+		PstreamGlobals::MPINeighbourCommunicators_[neighbourCommunicator];
+
+	int finalized = 0;
+	MPI_Finalized(&finalized);
+
+	if (graphComm != MPI_COMM_NULL && !finalized)
+	{
+		// Free communicator. Sets communicator to MPI_COMM_NULL
+		MPI_Comm_free(&graphComm);
+	}
+}
+
+
 tnbLib::label tnbLib::UPstream::nRequests()
 {
 	return PstreamGlobals::outstandingRequests_.size();
@@ -823,6 +1143,17 @@ bool tnbLib::UPstream::finishedRequest(const label i)
 }
 
 
+void tnbLib::UPstream::freeChannel(label& channel)
+{
+	if (debug)
+	{
+		Pout << "UPstream::freeChannel : channel:" << channel << endl;
+	}
+
+	PstreamGlobals::freePersistentChannel(channel);
+}
+
+
 int tnbLib::UPstream::allocateTag(const char* s)
 {
 	int tag;
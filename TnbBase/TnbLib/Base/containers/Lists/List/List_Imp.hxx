@@ -245,7 +245,7 @@ tnbLib::List<T>::~List()
 {
 	if (this->v_)
 	{
-		delete[] this->v_;
+		deleteArray(this->v_);
 	}
 }
 
@@ -266,7 +266,7 @@ void tnbLib::List<T>::setSize(const label newSize)
 	{
 		if (newSize > 0)
 		{
-			T* nv = new T[label(newSize)];
+			T* nv = newArray(label(newSize));
 
 			if (this->size_)
 			{
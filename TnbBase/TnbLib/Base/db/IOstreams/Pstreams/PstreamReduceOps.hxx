@@ -200,6 +200,30 @@ namespace tnbLib
 		label& request
 	);
 
+	// Non-blocking sum of a list of scalars in a single reduction.
+	// Sets request, -1 if the reduction has already completed.
+	FoamBase_EXPORT void reduce
+	(
+		scalar* Value,
+		const int size,
+		const sumOp<scalar>& bop,
+		const int tag,
+		const label comm,
+		label& request
+	);
+
+	// Non-blocking minimum of a list of scalars in a single reduction.
+	// Sets request
+	FoamBase_EXPORT void reduce
+	(
+		scalar* Value,
+		const int size,
+		const minOp<scalar>& bop,
+		const int tag,
+		const label comm,
+		label& request
+	);
+
 
 	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
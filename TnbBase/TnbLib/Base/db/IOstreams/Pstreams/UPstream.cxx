@@ -490,5 +490,27 @@ registerOptSwitch
 	tnbLib::UPstream::nPollProcInterfaces
 );
 
+bool tnbLib::UPstream::persistentRequests
+(
+	tnbLib::debug::optimisationSwitch("persistentRequests", 0)
+);
+registerOptSwitch
+(
+	"persistentRequests",
+	bool,
+	tnbLib::UPstream::persistentRequests
+);
+
+int tnbLib::UPstream::sharedMemoryBufferSize
+(
+	tnbLib::debug::optimisationSwitch("sharedMemoryBufferSize", 0)
+);
+registerOptSwitch
+(
+	"sharedMemoryBufferSize",
+	int,
+	tnbLib::UPstream::sharedMemoryBufferSize
+);
+
 
 // ************************************************************************* //
\ No newline at end of file
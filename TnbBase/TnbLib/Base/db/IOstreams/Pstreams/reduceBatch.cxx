@@ -0,0 +1,200 @@
+#include <reduceBatch.hxx>
+
+#include <PstreamReduceOps.hxx>
+#include <error.hxx>
+
+// * * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	//- Return true if the given request is not outstanding. Requests which
+	//  have been waited for by a caller of UPstream::waitRequests are no
+	//  longer in the list of outstanding requests
+	static bool requestCompleted(const label request)
+	{
+		return
+			request < 0
+			|| request >= UPstream::nRequests()
+			|| UPstream::finishedRequest(request);
+	}
+
+	static void waitForRequest(label& request)
+	{
+		if (request >= 0 && request < UPstream::nRequests())
+		{
+			UPstream::waitRequest(request);
+		}
+
+		request = -1;
+	}
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::reduceBatch::waitForRequests()
+{
+	const label lastRequest = tnbLib::max(sumRequest_, minRequest_);
+
+	if (lastRequest >= 0 && lastRequest == UPstream::nRequests() - 1)
+	{
+		// The reductions are the last outstanding requests. Complete them
+		// from the first one posted so that the list is truncated again
+		UPstream::waitRequests(startRequest_);
+
+		sumRequest_ = -1;
+		minRequest_ = -1;
+	}
+	else
+	{
+		// Requests posted after the batch are still outstanding and belong
+		// to another caller. Only complete the slots of the batch, which are
+		// removed by the waitRequests of the caller owning the earlier ones
+		waitForRequest(sumRequest_);
+		waitForRequest(minRequest_);
+	}
+}
+
+
+void tnbLib::reduceBatch::checkNotStarted() const
+{
+	if (started_)
+	{
+		FatalErrorInFunction
+			<< "Cannot add a value to a batch of reductions"
+			<< " which has already been started"
+			<< abort(FatalError);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::reduceBatch::reduceBatch(const label comm, const int tag)
+	:
+	comm_(comm),
+	tag_(tag),
+	sums_(),
+	mins_(),
+	sumRequest_(-1),
+	minRequest_(-1),
+	startRequest_(-1),
+	started_(false)
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::reduceBatch::~reduceBatch()
+{
+	// The reductions write into the lists, which must outlive them
+	waitForRequests();
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::reduceBatch::future tnbLib::reduceBatch::sum(const scalar localValue)
+{
+	checkNotStarted();
+	sums_.append(localValue);
+	return future(*this, future::SUM, sums_.size() - 1);
+}
+
+
+tnbLib::reduceBatch::future tnbLib::reduceBatch::min(const scalar localValue)
+{
+	checkNotStarted();
+	mins_.append(localValue);
+	return future(*this, future::MIN, mins_.size() - 1);
+}
+
+
+tnbLib::reduceBatch::future tnbLib::reduceBatch::max(const scalar localValue)
+{
+	checkNotStarted();
+	mins_.append(-localValue);
+	return future(*this, future::MAX, mins_.size() - 1);
+}
+
+
+void tnbLib::reduceBatch::start()
+{
+	if (started_)
+	{
+		return;
+	}
+
+	started_ = true;
+
+	if (!UPstream::parRun())
+	{
+		return;
+	}
+
+	startRequest_ = UPstream::nRequests();
+
+	if (sums_.size())
+	{
+		reduce
+		(
+			sums_.begin(),
+			sums_.size(),
+			sumOp<scalar>(),
+			tag_,
+			comm_,
+			sumRequest_
+		);
+	}
+
+	if (mins_.size())
+	{
+		reduce
+		(
+			mins_.begin(),
+			mins_.size(),
+			minOp<scalar>(),
+			tag_,
+			comm_,
+			minRequest_
+		);
+	}
+}
+
+
+bool tnbLib::reduceBatch::finished() const
+{
+	return
+		started_
+		&& requestCompleted(sumRequest_)
+		&& requestCompleted(minRequest_);
+}
+
+
+void tnbLib::reduceBatch::wait()
+{
+	start();
+
+	waitForRequests();
+}
+
+
+tnbLib::scalar tnbLib::reduceBatch::future::value() const
+{
+	batchPtr_->wait();
+
+	switch (op_)
+	{
+		case SUM:
+			return batchPtr_->sums_[index_];
+
+		case MIN:
+			return batchPtr_->mins_[index_];
+
+		default:
+			return -batchPtr_->mins_[index_];
+	}
+}
+
+
+// ************************************************************************* //
@@ -3,6 +3,7 @@
 #include <PstreamReduceOps.hxx>
 #include <argList.hxx>
 #include <IOdictionary.hxx>
+#include <listPool.hxx>
 
 // added by amir
 #include <fileOperation.hxx>
@@ -788,6 +789,17 @@ bool tnbLib::Time::run() const
 		{
 			functionObjects_.execute();
 			functionObjects_.end();
+
+			if (listPool::used())
+			{
+				listPool::writeStatistics(Info);
+
+				// The fields of the time loop are no longer recycled
+				listPool::clear();
+			}
+
+			// Write the queued field snapshots before the run ends
+			fileHandler().flush();
 		}
 	}
 
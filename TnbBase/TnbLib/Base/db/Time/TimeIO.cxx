@@ -583,7 +583,12 @@ bool tnbLib::Time::writeAndEnd()
 	stopAt_ = stopAtControl::writeNow;
 	endTime_ = value();
 
-	return writeNow();
+	const bool ok = writeNow();
+
+	// Write the queued field snapshots before the run ends
+	fileHandler().flush();
+
+	return ok;
 }
 
 
@@ -1,6 +1,7 @@
 #include <objectRegistry.hxx>
 
 #include <Time.hxx>
+#include <taskParallel.hxx>
 #include <IOstreams.hxx> // added by amir
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
@@ -142,6 +143,8 @@ const tnbLib::objectRegistry& tnbLib::objectRegistry::subRegistry
 
 tnbLib::label tnbLib::objectRegistry::getEvent() const
 {
+	taskParallel::sharedLock lock;
+
 	label curEvent = event_++;
 
 	if (event_ == labelMax)
@@ -181,6 +184,8 @@ tnbLib::label tnbLib::objectRegistry::getEvent() const
 
 bool tnbLib::objectRegistry::checkIn(regIOobject& io) const
 {
+	taskParallel::sharedLock lock;
+
 	if (objectRegistry::debug)
 	{
 		Pout << "objectRegistry::checkIn(regIOobject&) : "
@@ -195,6 +200,8 @@ bool tnbLib::objectRegistry::checkIn(regIOobject& io) const
 
 bool tnbLib::objectRegistry::checkOut(regIOobject& io) const
 {
+	taskParallel::sharedLock lock;
+
 	iterator iter = const_cast<objectRegistry&>(*this).find(io.name());
 
 	if (iter != end())
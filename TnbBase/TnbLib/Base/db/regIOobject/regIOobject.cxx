@@ -4,6 +4,7 @@
 #include <polyMesh.hxx>
 #include <registerSwitch.hxx>
 #include <fileOperation.hxx>
+#include <threadPool.hxx>
 
 #include <Pstream.hxx>  // added by amir
 
@@ -42,8 +43,9 @@ tnbLib::regIOobject::regIOobject(const IOobject& io, const bool isTime)
 		: db().getEvent()
 	)
 {
-	// Register with objectRegistry if requested
-	if (registerObject())
+	// Register with objectRegistry if requested. Objects constructed within
+	// a task are not registered, see taskParallel
+	if (registerObject() && !threadPool::inTask())
 	{
 		checkIn();
 	}
@@ -113,7 +115,7 @@ tnbLib::regIOobject::regIOobject
 	watchIndices_(),
 	eventNo_(db().getEvent())
 {
-	if (registerObject())
+	if (registerObject() && !threadPool::inTask())
 	{
 		checkIn();
 	}
@@ -161,6 +161,10 @@ namespace tnbLib
 		template<class Type>
 	scalar sumProd(const UList<Type>& f1, const UList<Type>& f2);
 
+	//- Scaled accumulation y += a*x
+	template<class Type>
+	void axpy(UList<Type>& y, const scalar a, const UList<Type>& x);
+
 	template<class Type>
 	Type sumCmptProd(const UList<Type>& f1, const UList<Type>& f2);
 
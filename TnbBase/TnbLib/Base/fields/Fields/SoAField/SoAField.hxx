@@ -0,0 +1,182 @@
+#pragma once
+#ifndef _SoAField_Header
+#define _SoAField_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::SoAField
+
+Description
+	Structure-of-arrays copy of a Field\<Type\> holding each component in a
+	separate contiguous scalarField.
+
+	Field\<vector\> and Field\<tensor\> store the components of each element
+	interleaved so extracting a component with Field::component allocates a
+	new field and gathers with a stride, and Field::replace scatters it back
+	with the same stride. SoAField transposes all the components in a
+	single pass in either direction (gather, scatter) using simdPack and
+	thereafter gives zero-copy access to each component as a scalarField,
+	which can be passed directly to the scalar linear solvers and operated
+	on with unit-stride, vectorisable loops.
+
+	\verbatim
+		SoAField<vector> UCmpts(U.primitiveField());
+
+		for (direction cmpt = 0; cmpt < vector::nComponents; cmpt++)
+		{
+			scalarField& UCmpt = UCmpts.component(cmpt);
+			...
+		}
+
+		UCmpts.scatter(U.primitiveFieldRef());
+	\endverbatim
+
+SourceFiles
+	SoAFieldI.H
+	SoAField.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <scalarField.hxx>
+#include <FixedList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class SoAField Declaration
+	\*---------------------------------------------------------------------------*/
+
+	template<class Type>
+	class SoAField
+	{
+	public:
+
+		// Static Data
+
+			//- Number of components
+		static const direction nComponents = pTraits<Type>::nComponents;
+
+
+	private:
+
+		// Private Data
+
+			//- Component fields
+		FixedList<scalarField, nComponents> components_;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct null
+		inline SoAField();
+
+		//- Construct given size, the components are not initialised
+		inline explicit SoAField(const label size);
+
+		//- Construct by transposing the given field
+		explicit SoAField(const UList<Type>& f);
+
+
+		// Member Functions
+
+			// Access
+
+				//- Return the number of elements
+		inline label size() const;
+
+		//- Return the component field
+		inline const scalarField& component(const direction d) const;
+
+		//- Return the component field for modification
+		inline scalarField& component(const direction d);
+
+
+		// Edit
+
+			//- Reset the number of elements
+		void setSize(const label size);
+
+		//- Set the components from the given interleaved field
+		void gather(const UList<Type>& f);
+
+		//- Set the given component from the given interleaved field
+		void gather(const direction d, const UList<Type>& f);
+
+		//- Write the components into the given interleaved field
+		void scatter(UList<Type>& f) const;
+
+		//- Return the interleaved field
+		tmp<Field<Type>> field() const;
+
+
+		// Kernels
+
+			//- Scaled accumulation this += a*x
+		void axpy(const scalar a, const SoAField<Type>& x);
+
+
+		// Member Operators
+
+		void operator=(const Type& t);
+		void operator+=(const SoAField<Type>& f);
+		void operator-=(const SoAField<Type>& f);
+		void operator*=(const UList<scalar>& s);
+		void operator*=(const scalar s);
+	};
+
+
+	// Global Functions
+
+	//- Sum of the products of all the components
+	template<class Type>
+	scalar sumProd(const SoAField<Type>& f1, const SoAField<Type>& f2);
+
+	//- Element-wise sum of the products of the components
+	template<class Type>
+	void dot(scalarField& res, const SoAField<Type>& f1, const SoAField<Type>& f2);
+
+	//- Element-wise sum of the squares of the components
+	template<class Type>
+	void magSqr(scalarField& res, const SoAField<Type>& f);
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <SoAFieldI.hxx>
+#include <SoAField_Imp.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_SoAField_Header
@@ -0,0 +1,470 @@
+#include <simdFields.hxx>
+
+#include <simdPack.hxx>
+#include <FieldM.hxx>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	//- Return the flattened component storage of a list
+	template<class Type>
+	inline const scalar* cmpts(const UList<Type>& f)
+	{
+		return reinterpret_cast<const scalar*>(f.cdata());
+	}
+
+	template<class Type>
+	inline scalar* cmpts(UList<Type>& f)
+	{
+		return reinterpret_cast<scalar*>(f.data());
+	}
+
+
+	//- Apply kernel(r, a) to the n elements of a with NA components
+	//  producing the NR components of r. Pairs of elements are processed as
+	//  component packs, a remaining odd element is duplicated into a pair.
+	template<direction NR, direction NA, class Kernel>
+	inline void simdUnary
+	(
+		scalar* r,
+		const scalar* a,
+		const label n,
+		const Kernel& kernel
+	)
+	{
+		simdPack ac[NA], rc[NR];
+
+		label i = 0;
+
+		for (; i + 1 < n; i += 2)
+		{
+			simdPack::deinterleave<NA>(a + NA * i, ac);
+			kernel(rc, ac);
+			simdPack::interleave<NR>(rc, r + NR * i);
+		}
+
+		if (i < n)
+		{
+			scalar ap[2 * NA], rp[2 * NR];
+
+			for (direction d = 0; d < NA; d++)
+			{
+				ap[d] = ap[NA + d] = a[NA*i + d];
+			}
+
+			simdPack::deinterleave<NA>(ap, ac);
+			kernel(rc, ac);
+			simdPack::interleave<NR>(rc, rp);
+
+			for (direction d = 0; d < NR; d++)
+			{
+				r[NR*i + d] = rp[d];
+			}
+		}
+	}
+
+
+	//- Binary equivalent of simdUnary, kernel(r, a, b)
+	template<direction NR, direction NA, direction NB, class Kernel>
+	inline void simdBinary
+	(
+		scalar* r,
+		const scalar* a,
+		const scalar* b,
+		const label n,
+		const Kernel& kernel
+	)
+	{
+		simdPack ac[NA], bc[NB], rc[NR];
+
+		label i = 0;
+
+		for (; i + 1 < n; i += 2)
+		{
+			simdPack::deinterleave<NA>(a + NA * i, ac);
+			simdPack::deinterleave<NB>(b + NB * i, bc);
+			kernel(rc, ac, bc);
+			simdPack::interleave<NR>(rc, r + NR * i);
+		}
+
+		if (i < n)
+		{
+			scalar ap[2 * NA], bp[2 * NB], rp[2 * NR];
+
+			for (direction d = 0; d < NA; d++)
+			{
+				ap[d] = ap[NA + d] = a[NA*i + d];
+			}
+
+			for (direction d = 0; d < NB; d++)
+			{
+				bp[d] = bp[NB + d] = b[NB*i + d];
+			}
+
+			simdPack::deinterleave<NA>(ap, ac);
+			simdPack::deinterleave<NB>(bp, bc);
+			kernel(rc, ac, bc);
+			simdPack::interleave<NR>(rc, rp);
+
+			for (direction d = 0; d < NR; d++)
+			{
+				r[NR*i + d] = rp[d];
+			}
+		}
+	}
+
+
+	//- Sum of the products of n consecutive scalars
+	inline scalar simdSumProd(const scalar* a, const scalar* b, const label n)
+	{
+		simdPack s0(0.0), s1(0.0);
+
+		label i = 0;
+
+		for (; i + 3 < n; i += 4)
+		{
+			s0 += simdPack::load(a + i)*simdPack::load(b + i);
+			s1 += simdPack::load(a + i + 2)*simdPack::load(b + i + 2);
+		}
+
+		for (; i + 1 < n; i += 2)
+		{
+			s0 += simdPack::load(a + i)*simdPack::load(b + i);
+		}
+
+		scalar s = (s0 + s1).sum();
+
+		for (; i < n; i++)
+		{
+			s += a[i] * b[i];
+		}
+
+		return s;
+	}
+
+
+	//- y += s*x for n consecutive scalars
+	inline void simdAxpy(scalar* y, const scalar s, const scalar* x, const label n)
+	{
+		const simdPack sp(s);
+
+		label i = 0;
+
+		for (; i + 1 < n; i += 2)
+		{
+			(simdPack::load(y + i) + sp * simdPack::load(x + i)).store(y + i);
+		}
+
+		for (; i < n; i++)
+		{
+			y[i] += s * x[i];
+		}
+	}
+
+
+	//- Sequential sum of the component products, as VectorSpace operator&&
+	template<direction N>
+	inline simdPack dotdotPacks(const simdPack* a, const simdPack* b)
+	{
+		simdPack s(a[0] * b[0]);
+
+		for (direction d = 1; d < N; d++)
+		{
+			s += a[d] * b[d];
+		}
+
+		return s;
+	}
+
+
+	//- Inner product of tensor and vector packs, as Tensor operator&
+	inline void tensorDotVectorPacks
+	(
+		simdPack* r,
+		const simdPack* t,
+		const simdPack* v
+	)
+	{
+		for (direction i = 0; i < 3; i++)
+		{
+			r[i] = t[3 * i] * v[0] + t[3 * i + 1] * v[1] + t[3 * i + 2] * v[2];
+		}
+	}
+
+} // End namespace tnbLib
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+void tnbLib::magSqr(Field<scalar>& res, const UList<vector>& f)
+{
+	checkFields(res, f, "f1 = magSqr(f2)");
+
+	simdUnary<1, 3>
+	(
+		cmpts(res), cmpts(f), res.size(),
+		[](simdPack* r, const simdPack* a)
+		{
+			r[0] = dotdotPacks<3>(a, a);
+		}
+	);
+}
+
+
+void tnbLib::magSqr(Field<scalar>& res, const UList<tensor>& f)
+{
+	checkFields(res, f, "f1 = magSqr(f2)");
+
+	simdUnary<1, 9>
+	(
+		cmpts(res), cmpts(f), res.size(),
+		[](simdPack* r, const simdPack* a)
+		{
+			r[0] = dotdotPacks<9>(a, a);
+		}
+	);
+}
+
+
+void tnbLib::dot
+(
+	Field<scalar>& res,
+	const UList<vector>& f1,
+	const UList<vector>& f2
+)
+{
+	checkFields(res, f1, f2, "f1 = f2 & f3");
+
+	simdBinary<1, 3, 3>
+	(
+		cmpts(res), cmpts(f1), cmpts(f2), res.size(),
+		[](simdPack* r, const simdPack* a, const simdPack* b)
+		{
+			r[0] = dotdotPacks<3>(a, b);
+		}
+	);
+}
+
+
+void tnbLib::dot
+(
+	Field<vector>& res,
+	const UList<tensor>& f1,
+	const UList<vector>& f2
+)
+{
+	checkFields(res, f1, f2, "f1 = f2 & f3");
+
+	simdBinary<3, 9, 3>
+	(
+		cmpts(res), cmpts(f1), cmpts(f2), res.size(),
+		[](simdPack* r, const simdPack* t, const simdPack* v)
+		{
+			for (direction i = 0; i < 3; i++)
+			{
+				r[i] = t[3 * i] * v[0] + t[3 * i + 1] * v[1] + t[3 * i + 2] * v[2];
+			}
+		}
+	);
+}
+
+
+void tnbLib::dot
+(
+	Field<tensor>& res,
+	const UList<tensor>& f1,
+	const UList<tensor>& f2
+)
+{
+	checkFields(res, f1, f2, "f1 = f2 & f3");
+
+	simdBinary<9, 9, 9>
+	(
+		cmpts(res), cmpts(f1), cmpts(f2), res.size(),
+		[](simdPack* r, const simdPack* a, const simdPack* b)
+		{
+			for (direction i = 0; i < 3; i++)
+			{
+				for (direction j = 0; j < 3; j++)
+				{
+					r[3 * i + j] =
+						a[3 * i] * b[j]
+						+ a[3 * i + 1] * b[3 + j]
+						+ a[3 * i + 2] * b[6 + j];
+				}
+			}
+		}
+	);
+}
+
+
+void tnbLib::cross
+(
+	Field<vector>& res,
+	const UList<vector>& f1,
+	const UList<vector>& f2
+)
+{
+	checkFields(res, f1, f2, "f1 = f2 ^ f3");
+
+	simdBinary<3, 3, 3>
+	(
+		cmpts(res), cmpts(f1), cmpts(f2), res.size(),
+		[](simdPack* r, const simdPack* a, const simdPack* b)
+		{
+			r[0] = a[1] * b[2] - a[2] * b[1];
+			r[1] = a[2] * b[0] - a[0] * b[2];
+			r[2] = a[0] * b[1] - a[1] * b[0];
+		}
+	);
+}
+
+
+void tnbLib::dotdot
+(
+	Field<scalar>& res,
+	const UList<vector>& f1,
+	const UList<vector>& f2
+)
+{
+	dot(res, f1, f2);
+}
+
+
+void tnbLib::dotdot
+(
+	Field<scalar>& res,
+	const UList<tensor>& f1,
+	const UList<tensor>& f2
+)
+{
+	checkFields(res, f1, f2, "f1 = f2 && f3");
+
+	simdBinary<1, 9, 9>
+	(
+		cmpts(res), cmpts(f1), cmpts(f2), res.size(),
+		[](simdPack* r, const simdPack* a, const simdPack* b)
+		{
+			r[0] = dotdotPacks<9>(a, b);
+		}
+	);
+}
+
+
+tnbLib::scalar tnbLib::sumProd
+(
+	const UList<vector>& f1,
+	const UList<vector>& f2
+)
+{
+	if (f1.size() && (f1.size() == f2.size()))
+	{
+		return simdSumProd(cmpts(f1), cmpts(f2), 3 * f1.size());
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+
+tnbLib::scalar tnbLib::sumProd
+(
+	const UList<tensor>& f1,
+	const UList<tensor>& f2
+)
+{
+	if (f1.size() && (f1.size() == f2.size()))
+	{
+		return simdSumProd(cmpts(f1), cmpts(f2), 9 * f1.size());
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+
+void tnbLib::transform
+(
+	Field<vector>& rtf,
+	const Field<tensor>& trf,
+	const Field<vector>& tf
+)
+{
+	if (trf.size() == 1)
+	{
+		simdPack t[9];
+
+		for (direction d = 0; d < 9; d++)
+		{
+			t[d] = simdPack(trf[0][d]);
+		}
+
+		simdUnary<3, 3>
+		(
+			cmpts(rtf), cmpts(tf), rtf.size(),
+			[&t](simdPack* r, const simdPack* v)
+			{
+				tensorDotVectorPacks(r, t, v);
+			}
+		);
+	}
+	else
+	{
+		dot(rtf, trf, tf);
+	}
+}
+
+
+void tnbLib::axpy
+(
+	UList<scalar>& y,
+	const scalar a,
+	const UList<scalar>& x
+)
+{
+	checkFields(y, x, "f1 += s*f2");
+	simdAxpy(cmpts(y), a, cmpts(x), y.size());
+}
+
+
+void tnbLib::axpy
+(
+	UList<vector>& y,
+	const scalar a,
+	const UList<vector>& x
+)
+{
+	checkFields(y, x, "f1 += s*f2");
+	simdAxpy(cmpts(y), a, cmpts(x), 3 * y.size());
+}
+
+
+void tnbLib::axpy
+(
+	UList<symmTensor>& y,
+	const scalar a,
+	const UList<symmTensor>& x
+)
+{
+	checkFields(y, x, "f1 += s*f2");
+	simdAxpy(cmpts(y), a, cmpts(x), 6 * y.size());
+}
+
+
+void tnbLib::axpy
+(
+	UList<tensor>& y,
+	const scalar a,
+	const UList<tensor>& x
+)
+{
+	checkFields(y, x, "f1 += s*f2");
+	simdAxpy(cmpts(y), a, cmpts(x), 9 * y.size());
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,168 @@
+#pragma once
+#ifndef _simdFields_Header
+#define _simdFields_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2018 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+InNamespace
+	tnbLib
+
+Description
+	Explicitly vectorised kernels for the hot field operations on vector and
+	tensor fields.
+
+	The array-of-structures storage of Field<vector> and Field<tensor>
+	prevents the compiler from vectorising the element-by-element loops of
+	FieldM.H. The functions below transpose pairs of elements into
+	component packs (see simdPack), operate on the packs and transpose the
+	result back. They are non-template overloads of the corresponding
+	FieldFunctions templates and are therefore selected wherever the
+	operands have these types, including the operators &, ^ and && and
+	transform(tensorField, vectorField).
+
+	The element kernels evaluate the products in the same order as the
+	VectorSpace operators so the results are identical to the generic
+	implementation. The reductions (sumProd) accumulate in two interleaved
+	partial sums and may differ from the sequential sum in the last bits.
+
+	axpy (y += a*x) is provided for all types by FieldFunctions and
+	specialised here to operate on the flattened component storage.
+
+SourceFiles
+	simdFields.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <scalarField.hxx>
+#include <vector.hxx>
+#include <tensor.hxx>
+#include <symmTensor.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+	FoamBase_EXPORT void magSqr(Field<scalar>& res, const UList<vector>& f);
+	FoamBase_EXPORT void magSqr(Field<scalar>& res, const UList<tensor>& f);
+
+	FoamBase_EXPORT void dot
+	(
+		Field<scalar>& res,
+		const UList<vector>& f1,
+		const UList<vector>& f2
+	);
+
+	FoamBase_EXPORT void dot
+	(
+		Field<vector>& res,
+		const UList<tensor>& f1,
+		const UList<vector>& f2
+	);
+
+	FoamBase_EXPORT void dot
+	(
+		Field<tensor>& res,
+		const UList<tensor>& f1,
+		const UList<tensor>& f2
+	);
+
+	FoamBase_EXPORT void cross
+	(
+		Field<vector>& res,
+		const UList<vector>& f1,
+		const UList<vector>& f2
+	);
+
+	FoamBase_EXPORT void dotdot
+	(
+		Field<scalar>& res,
+		const UList<vector>& f1,
+		const UList<vector>& f2
+	);
+
+	FoamBase_EXPORT void dotdot
+	(
+		Field<scalar>& res,
+		const UList<tensor>& f1,
+		const UList<tensor>& f2
+	);
+
+	FoamBase_EXPORT scalar sumProd
+	(
+		const UList<vector>& f1,
+		const UList<vector>& f2
+	);
+
+	FoamBase_EXPORT scalar sumProd
+	(
+		const UList<tensor>& f1,
+		const UList<tensor>& f2
+	);
+
+	FoamBase_EXPORT void transform
+	(
+		Field<vector>& rtf,
+		const Field<tensor>& trf,
+		const Field<vector>& tf
+	);
+
+	FoamBase_EXPORT void axpy
+	(
+		UList<scalar>& y,
+		const scalar a,
+		const UList<scalar>& x
+	);
+
+	FoamBase_EXPORT void axpy
+	(
+		UList<vector>& y,
+		const scalar a,
+		const UList<vector>& x
+	);
+
+	FoamBase_EXPORT void axpy
+	(
+		UList<symmTensor>& y,
+		const scalar a,
+		const UList<symmTensor>& x
+	);
+
+	FoamBase_EXPORT void axpy
+	(
+		UList<tensor>& y,
+		const scalar a,
+		const UList<tensor>& x
+	);
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_simdFields_Header
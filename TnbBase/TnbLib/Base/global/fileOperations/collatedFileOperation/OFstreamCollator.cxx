@@ -148,6 +148,36 @@ bool tnbLib::OFstreamCollator::writeFile
 }
 
 
+bool tnbLib::OFstreamCollator::writeSnapshotFile(writeData& object)
+{
+	const label comm = object.comm_;
+
+	if (debug)
+	{
+		Pout << "OFstreamCollator : Collecting snapshot of "
+			<< object.pathName_ << " using comm " << comm << endl;
+	}
+
+	labelList recvSizes;
+	decomposedBlockData::gather(comm, label(object.data_.size()), recvSizes);
+
+	const PtrList<SubList<char>> dummySlaveData;
+	return writeFile
+	(
+		comm,
+		decomposedBlockData::typeName,
+		object.pathName_,
+		object.data_,
+		recvSizes,
+		dummySlaveData,
+		IOstream::BINARY,
+		object.version_,
+		object.compression_,
+		false
+	);
+}
+
+
 void* tnbLib::OFstreamCollator::writeAll(void *threadarg)
 {
 	OFstreamCollator& handler = *static_cast<OFstreamCollator*>(threadarg);
@@ -169,6 +199,17 @@ void* tnbLib::OFstreamCollator::writeAll(void *threadarg)
 		{
 			break;
 		}
+		else if (ptr->gather_)
+		{
+			if (!writeSnapshotFile(*ptr))
+			{
+				FatalIOErrorInFunction(ptr->pathName_)
+					<< "Failed writing " << ptr->pathName_
+					<< exit(FatalIOError);
+			}
+
+			delete ptr;
+		}
 		else
 		{
 			// Convert storage to pointers
@@ -238,18 +279,24 @@ void tnbLib::OFstreamCollator::waitForBufferSpace(const off_t wantedSize) const
 	{
 		// Count files to be written
 		off_t totalSize = 0;
+		label nObjects = 0;
+		bool threadRunning = false;
 
 		{
 			std::lock_guard<std::mutex> guard(mutex_);
 			forAllConstIter(FIFOStack<writeData*>, objects_, iter)
 			{
 				totalSize += iter()->size();
+				nObjects++;
 			}
+			threadRunning = threadRunning_;
 		}
 
+		// When waiting for all files also wait for the file being written,
+		// which has already been taken off the stack
 		if
 			(
-				totalSize == 0
+				(nObjects == 0 && (wantedSize >= 0 || !threadRunning))
 				|| (wantedSize >= 0 && (totalSize + wantedSize) <= maxBufferSize_)
 				)
 		{
@@ -271,6 +318,34 @@ void tnbLib::OFstreamCollator::waitForBufferSpace(const off_t wantedSize) const
 }
 
 
+void tnbLib::OFstreamCollator::push(writeData* objectPtr)
+{
+	// Append to thread buffer
+	objects_.push(objectPtr);
+
+	// Start thread if not running
+	if (!threadRunning_)
+	{
+		if (thread_.valid())
+		{
+			if (debug)
+			{
+				Pout << "OFstreamCollator : Waiting for write thread"
+					<< endl;
+			}
+			thread_().join();
+		}
+
+		if (debug)
+		{
+			Pout << "OFstreamCollator : Starting write thread" << endl;
+		}
+		thread_.reset(new std::thread(writeAll, this));
+		threadRunning_ = true;
+	}
+}
+
+
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
 tnbLib::OFstreamCollator::OFstreamCollator(const off_t maxBufferSize)
@@ -479,31 +554,7 @@ bool tnbLib::OFstreamCollator::write
 
 		{
 			std::lock_guard<std::mutex> guard(mutex_);
-
-			// Append to thread buffer
-			objects_.push(fileAndDataPtr.ptr());
-
-			// Start thread if not running
-			if (!threadRunning_)
-			{
-				if (thread_.valid())
-				{
-					if (debug)
-					{
-						Pout << "OFstreamCollator : Waiting for write thread"
-							<< endl;
-					}
-					thread_().join();
-				}
-
-				if (debug)
-				{
-					Pout << "OFstreamCollator : Starting write thread"
-						<< endl;
-				}
-				thread_.reset(new std::thread(writeAll, this));
-				threadRunning_ = true;
-			}
+			push(fileAndDataPtr.ptr());
 		}
 
 		return true;
@@ -536,7 +587,7 @@ bool tnbLib::OFstreamCollator::write
 
 			// Push all file info on buffer. Note that no slave data provided
 			// so it will trigger communication inside the thread
-			objects_.push
+			push
 			(
 				new writeData
 				(
@@ -551,26 +602,6 @@ bool tnbLib::OFstreamCollator::write
 					append
 				)
 			);
-
-			if (!threadRunning_)
-			{
-				if (thread_.valid())
-				{
-					if (debug)
-					{
-						Pout << "OFstreamCollator : Waiting for write thread"
-							<< endl;
-					}
-					thread_().join();
-				}
-
-				if (debug)
-				{
-					Pout << "OFstreamCollator : Starting write thread" << endl;
-				}
-				thread_.reset(new std::thread(writeAll, this));
-				threadRunning_ = true;
-			}
 		}
 
 		return true;
@@ -594,4 +625,45 @@ void tnbLib::OFstreamCollator::waitAll()
 }
 
 
+void tnbLib::OFstreamCollator::writeSnapshot
+(
+	const string& data,
+	const fileName& fName,
+	IOstream::streamFormat fmt,
+	IOstream::versionNumber ver,
+	IOstream::compressionType cmp
+)
+{
+	if (debug)
+	{
+		Pout << "OFstreamCollator : thread gather and write of "
+			<< fName << " using communicator " << threadComm_ << endl;
+	}
+
+	if (!UPstream::haveThreads())
+	{
+		FatalErrorInFunction
+			<< "mpi does not seem to have thread support."
+			<< " Cannot write " << fName << " asynchronously"
+			<< exit(FatalError);
+	}
+
+	std::lock_guard<std::mutex> guard(mutex_);
+	push(new writeData(threadComm_, fName, data, fmt, ver, cmp));
+}
+
+
+void tnbLib::OFstreamCollator::waitSnapshots()
+{
+	// The snapshots are collected by the threads of all
+	// processors so wait on all of them
+	if (debug)
+	{
+		Pout << "OFstreamCollator : waiting for thread to have written all"
+			<< " snapshots" << endl;
+	}
+	waitForBufferSpace(-1);
+}
+
+
 // ************************************************************************* //
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include <IOstreams.hxx> // added by amir
 #include <IStringStream.hxx>  // added by amir
+#include <OStringStream.hxx>
 
 /* * * * * * * * * * * * * * * Static Member Data  * * * * * * * * * * * * * */
 
@@ -37,6 +38,17 @@ namespace tnbLib
 			collatedFileOperation::maxThreadFileBufferSize
 		);
 
+		int collatedFileOperation::asyncWrite
+		(
+			debug::optimisationSwitch("asyncWrite", 0)
+		);
+		registerOptSwitch
+		(
+			"asyncWrite",
+			int,
+			collatedFileOperation::asyncWrite
+		);
+
 		// Mark as needing threaded mpi
 		addNamedToRunTimeSelectionTable
 		(
@@ -240,7 +252,8 @@ tnbLib::fileOperations::collatedFileOperation::collatedFileOperation
 	myComm_(comm_),
 	writer_(maxThreadFileBufferSize, comm_),
 	nProcs_(Pstream::nProcs()),
-	ioRanks_(ioRanks())
+	ioRanks_(ioRanks()),
+	snapshotTimeIndex_(-1)
 {
 	if (verbose)
 	{
@@ -270,6 +283,15 @@ tnbLib::fileOperations::collatedFileOperation::collatedFileOperation
 				"to 0 in" << nl
 				<< "         $FOAM_ETC/controlDict"
 				<< endl;
+
+			if (asyncWrite)
+			{
+				InfoHeader
+					<< "         Fields collected and written asynchronously "
+					"since asyncWrite = " << asyncWrite << nl
+					<< "         Requires thread support enabled in MPI"
+					<< endl;
+			}
 		}
 
 		if (ioRanks_.size())
@@ -328,7 +350,8 @@ tnbLib::fileOperations::collatedFileOperation::collatedFileOperation
 	myComm_(-1),
 	writer_(maxThreadFileBufferSize, comm),
 	nProcs_(Pstream::nProcs()),
-	ioRanks_(ioRanks)
+	ioRanks_(ioRanks),
+	snapshotTimeIndex_(-1)
 {
 	if (verbose)
 	{
@@ -358,6 +381,15 @@ tnbLib::fileOperations::collatedFileOperation::collatedFileOperation
 				"to 0 in" << nl
 				<< "         $FOAM_ETC/controlDict"
 				<< endl;
+
+			if (asyncWrite)
+			{
+				InfoHeader
+					<< "         Fields collected and written asynchronously "
+					"since asyncWrite = " << asyncWrite << nl
+					<< "         Requires thread support enabled in MPI"
+					<< endl;
+			}
 		}
 
 		if
@@ -557,6 +589,45 @@ bool tnbLib::fileOperations::collatedFileOperation::writeObject
 			{
 				writer_.waitAll();
 			}
+			else if (asyncWrite && UPstream::haveThreads())
+			{
+				// Double buffering: the snapshots of the previous write are
+				// written before those of this one are taken
+				if (tm.timeIndex() != snapshotTimeIndex_)
+				{
+					writer_.waitSnapshots();
+					snapshotTimeIndex_ = tm.timeIndex();
+				}
+
+				// Format here so that the thread only handles bytes and
+				// nothing it uses refers to the object, its mesh or the
+				// database. Continue on failure since the threads of the
+				// other processors wait for the data
+				OStringStream os(fmt, ver);
+
+				bool ok = true;
+				if (Pstream::master(comm_))
+				{
+					ok = io.writeHeader(os);
+				}
+				ok = io.writeData(os) && ok;
+				if (Pstream::master(comm_))
+				{
+					IOobject::writeEndDivider(os);
+				}
+
+				if (debug)
+				{
+					Pout << "collatedFileOperation::writeObject :"
+						<< " For object : " << io.name()
+						<< " queued snapshot for output to " << pathName
+						<< endl;
+				}
+
+				writer_.writeSnapshot(os.str(), pathName, fmt, ver, cmp);
+
+				return ok;
+			}
 
 			threadedCollatedOFstream os
 			(
@@ -601,8 +672,16 @@ void tnbLib::fileOperations::collatedFileOperation::flush() const
 			<< endl;
 	}
 	masterUncollatedFileOperation::flush();
-	// Wait for thread to finish (note: also removes thread)
-	writer_.waitAll();
+	// Wait for thread to finish (note: also removes thread). Snapshots are
+	// held by all processors
+	if (asyncWrite)
+	{
+		writer_.waitSnapshots();
+	}
+	else
+	{
+		writer_.waitAll();
+	}
 }
 
 
@@ -34,6 +34,16 @@ Description
 
 	Uses threading if maxThreadFileBufferSize > 0.
 
+	With the asyncWrite optimisation switch set, objects are formatted into
+	a buffer when they are written and the collecting onto the master and
+	the writing of the buffers are done by the write thread while the
+	solution continues. The buffers of a write time are written before
+	those of the next one are formatted, so at most one write time is
+	held. The buffers do not refer to the objects or the mesh, which can
+	therefore change before they are written. The pending buffers are
+	written by flush(), which is called when Time::run() ends the run and
+	by Time::writeAndEnd().
+
 See also
 	masterUncollatedFileOperation
 
@@ -79,6 +89,9 @@ namespace tnbLib
 			//- Ranks of IO handlers
 			const labelList ioRanks_;
 
+			//- Time index of the last snapshots queued for writing
+			mutable label snapshotTimeIndex_;
+
 
 			// Private Member Functions
 
@@ -116,6 +129,12 @@ namespace tnbLib
 				//  Read as float to enable easy specification of large sizes.
 			static FoamBase_EXPORT float maxThreadFileBufferSize;
 
+			//- Format objects into a buffer collected and written by the
+			//  write thread. Requires threading and thread support in MPI.
+			//  Holds the formatted objects of a write time on all processors
+			//  until they are written
+			static FoamBase_EXPORT int asyncWrite;
+
 
 			// Constructors
 
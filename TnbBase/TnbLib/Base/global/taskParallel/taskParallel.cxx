@@ -0,0 +1,44 @@
+#include <taskParallel.hxx>
+
+#include <refCount.hxx>
+#include <UPstream.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+std::recursive_mutex tnbLib::taskParallel::mutex_;
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+bool tnbLib::taskParallel::concurrent(const label nTasks)
+{
+	return
+		refCount::threadSafe
+	 && nTasks > 1
+	 && threadPool::nThreads > 1
+	 && !UPstream::parRun()
+	 && !threadPool::inTask();
+}
+
+
+void tnbLib::taskParallel::run
+(
+	const label nTasks,
+	const std::function<void(const label)>& body
+)
+{
+	if (concurrent(nTasks))
+	{
+		threadPool::global().parallelFor(nTasks, body);
+	}
+	else
+	{
+		for (label taski = 0; taski < nTasks; taski++)
+		{
+			body(taski);
+		}
+	}
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,265 @@
+#include <threadPool.hxx>
+
+#include <firstTouch.hxx>
+#include <registerSwitch.hxx>
+#include <IOstreams.hxx>
+#include <error.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(threadPool, 0);
+
+	//- Set for worker threads and for the caller while it executes tasks
+	static thread_local bool inThreadPoolTask_ = false;
+
+	//- Serialises the construction of the global pool
+	static std::mutex globalPoolMutex_;
+}
+
+int tnbLib::threadPool::nThreads
+(
+	tnbLib::debug::optimisationSwitch("nThreads", 1)
+);
+
+registerOptSwitch
+(
+	"nThreads",
+	int,
+	tnbLib::threadPool::nThreads
+);
+
+tnbLib::autoPtr<tnbLib::threadPool> tnbLib::threadPool::globalPtr_;
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::threadPool::work(const label threadi)
+{
+	inThreadPoolTask_ = true;
+
+	label seen = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+
+			workCondition_.wait
+			(
+				lock,
+				[&]() { return stop_ || generation_ != seen; }
+			);
+
+			if (stop_)
+			{
+				return;
+			}
+
+			seen = generation_;
+		}
+
+		runTasks(threadi);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			if (--nBusy_ == 0)
+			{
+				doneCondition_.notify_one();
+			}
+		}
+	}
+}
+
+
+void tnbLib::threadPool::runTasks(const label threadi)
+{
+	const std::function<void(const label)>& body = *bodyPtr_;
+
+	try
+	{
+		if (staticSchedule_)
+		{
+			for
+				(
+					label taski = threadi;
+					taski < nTasks_ && !failed_;
+					taski += nThreads_
+					)
+			{
+				body(taski);
+			}
+
+			return;
+		}
+
+		for
+			(
+				label taski = nextTask_++;
+				taski < nTasks_ && !failed_;
+				taski = nextTask_++
+				)
+		{
+			body(taski);
+		}
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!exceptionPtr_)
+		{
+			exceptionPtr_ = std::current_exception();
+		}
+
+		failed_ = true;
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::threadPool::threadPool(const label nThreads)
+	:
+	nThreads_(max(nThreads, label(1))),
+	workers_(nThreads_ - 1),
+	bodyPtr_(nullptr),
+	nTasks_(0),
+	nextTask_(0),
+	staticSchedule_(false),
+	nBusy_(0),
+	generation_(0),
+	stop_(false),
+	failed_(false)
+{
+	if (debug)
+	{
+		Info << "threadPool : starting " << workers_.size()
+			<< " worker threads" << endl;
+	}
+
+	forAll(workers_, i)
+	{
+		workers_[i].reset(new std::thread(&threadPool::work, this, i + 1));
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::threadPool::~threadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+
+	workCondition_.notify_all();
+
+	forAll(workers_, i)
+	{
+		workers_[i]().join();
+		workers_[i].clear();
+	}
+}
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+tnbLib::threadPool& tnbLib::threadPool::global()
+{
+	const label n = max(nThreads, 1);
+
+	std::lock_guard<std::mutex> lock(globalPoolMutex_);
+
+	if (!globalPtr_.valid())
+	{
+		globalPtr_.reset(new threadPool(n));
+	}
+	else if (globalPtr_->size() != n)
+	{
+		if (inThreadPoolTask_)
+		{
+			FatalErrorInFunction
+				<< "Cannot resize the global thread pool from "
+				<< globalPtr_->size() << " to " << n
+				<< " threads from within a task"
+				<< abort(FatalError);
+		}
+
+		globalPtr_.reset(new threadPool(n));
+	}
+
+	return globalPtr_();
+}
+
+
+bool tnbLib::threadPool::inTask()
+{
+	return inThreadPoolTask_;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::threadPool::parallelFor
+(
+	const label nTasks,
+	const std::function<void(const label)>& body
+)
+{
+	// Serial execution: no workers, a single task or a nested call
+	if (workers_.empty() || nTasks <= 1 || inThreadPoolTask_)
+	{
+		for (label taski = 0; taski < nTasks; taski++)
+		{
+			body(taski);
+		}
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> loopLock(loopMutex_);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		bodyPtr_ = &body;
+		nTasks_ = nTasks;
+		nextTask_ = 0;
+		staticSchedule_ = firstTouch::numaFirstTouch != 0;
+		failed_ = false;
+		exceptionPtr_ = nullptr;
+		nBusy_ = workers_.size();
+		generation_++;
+	}
+
+	workCondition_.notify_all();
+
+	// The calling thread takes part in the loop
+	inThreadPoolTask_ = true;
+	runTasks(0);
+	inThreadPoolTask_ = false;
+
+	std::exception_ptr exceptionPtr;
+
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+
+		doneCondition_.wait(lock, [&]() { return nBusy_ == 0; });
+
+		bodyPtr_ = nullptr;
+		exceptionPtr = exceptionPtr_;
+		exceptionPtr_ = nullptr;
+	}
+
+	if (exceptionPtr)
+	{
+		std::rethrow_exception(exceptionPtr);
+	}
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,225 @@
+#pragma once
+#ifndef _threadPool_Header
+#define _threadPool_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::threadPool
+
+Description
+	Persistent pool of worker threads for shared-memory parallel loops
+	within a rank.
+
+	The number of threads (including the calling thread) is set by the
+	"nThreads" optimisation switch. With the default of 1 no worker thread
+	is started and all loops are executed by the caller so the serial code
+	path is unchanged.
+
+	Loops are split into a given number of independent tasks which are
+	handed out dynamically to the workers and the calling thread. Nested
+	calls from within a task are executed serially by the calling worker.
+	If NUMA first-touch placement is enabled (see firstTouch) the tasks are
+	instead assigned statically, task i to thread i modulo the number of
+	threads, the calling thread being thread 0, so that a given block of
+	data is always processed by the thread which placed it.
+
+	An exception thrown by a task stops the handing out of the remaining
+	tasks and is rethrown by parallelFor on the calling thread once all the
+	threads have finished. If several tasks throw, the first exception is
+	rethrown.
+
+	The global pool is constructed on first use and reconstructed if the
+	nThreads switch has changed. It cannot be resized from within a task.
+
+	\verbatim
+		threadPool::global().parallelFor
+		(
+			nBlocks,
+			[&](const label blocki)
+			{
+				...
+			}
+		);
+	\endverbatim
+
+SourceFiles
+	threadPool.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <label.hxx>
+#include <autoPtr.hxx>
+#include <List.hxx>
+#include <typeInfo.hxx>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class threadPool Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class threadPool
+	{
+		// Private Data
+
+			//- Number of threads including the calling thread
+		const label nThreads_;
+
+		//- Worker threads
+		List<autoPtr<std::thread>> workers_;
+
+		//- Serialises loops posted from different threads
+		std::mutex loopMutex_;
+
+		//- Synchronisation of the workers
+		std::mutex mutex_;
+
+		//- Signalled when new work is posted or the pool is stopped
+		std::condition_variable workCondition_;
+
+		//- Signalled when the last worker has finished the current loop
+		std::condition_variable doneCondition_;
+
+		//- Current loop body
+		const std::function<void(const label)>* bodyPtr_;
+
+		//- Number of tasks in the current loop
+		label nTasks_;
+
+		//- Next task to be handed out
+		std::atomic<label> nextTask_;
+
+		//- Assign the tasks of the current loop statically to the threads
+		bool staticSchedule_;
+
+		//- Number of workers still busy with the current loop
+		label nBusy_;
+
+		//- Loop counter, used by the workers to detect new work
+		label generation_;
+
+		//- Stop flag
+		bool stop_;
+
+		//- Set when a task of the current loop has thrown
+		std::atomic<bool> failed_;
+
+		//- First exception thrown by a task of the current loop
+		std::exception_ptr exceptionPtr_;
+
+		//- Global pool
+		static FoamBase_EXPORT autoPtr<threadPool> globalPtr_;
+
+
+		// Private Member Functions
+
+			//- Worker thread main loop
+		FoamBase_EXPORT void work(const label threadi);
+
+		//- Execute tasks of the current loop until none are left, storing
+		//  the first exception thrown by a task
+		FoamBase_EXPORT void runTasks(const label threadi);
+
+
+	public:
+
+		// Static Data
+
+			//- Number of threads per rank (optimisation switch)
+		static FoamBase_EXPORT int nThreads;
+
+
+		// Declare name of the class and its debug switch
+		//ClassName("threadPool");
+		static const char* typeName_() { return "threadPool"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+
+
+		// Constructors
+
+			//- Construct given the number of threads including the caller
+		FoamBase_EXPORT explicit threadPool(const label nThreads);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT threadPool(const threadPool&) = delete;
+
+
+		//- Destructor
+		FoamBase_EXPORT ~threadPool();
+
+
+		// Static Member Functions
+
+			//- Return the global pool sized according to the nThreads switch.
+		//  Fatal if the switch has changed and this is called from a task.
+		static FoamBase_EXPORT threadPool& global();
+
+		//- Return true if called from within a pool task
+		static FoamBase_EXPORT bool inTask();
+
+
+		// Member Functions
+
+			//- Return the number of threads including the calling thread
+		label size() const
+		{
+			return nThreads_;
+		}
+
+		//- Execute body(taski) for taski = 0..nTasks-1, distributing the
+		//  tasks over the pool. Returns when all tasks have finished and
+		//  rethrows the first exception thrown by a task.
+		FoamBase_EXPORT void parallelFor
+		(
+			const label nTasks,
+			const std::function<void(const label)>& body
+		);
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const threadPool&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_threadPool_Header
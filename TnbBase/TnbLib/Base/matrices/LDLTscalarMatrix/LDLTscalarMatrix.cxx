@@ -0,0 +1,1067 @@
+#include <LDLTscalarMatrix.hxx>
+
+#include <lduMatrix.hxx>
+#include <procLduMatrix.hxx>
+#include <procLduInterface.hxx>
+#include <cyclicLduInterface.hxx>
+#include <ListOps.hxx>
+#include <SubList.hxx>
+#include <SubField.hxx>
+
+#include <IOstreams.hxx>
+#include <IPstream.hxx>
+#include <OPstream.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(LDLTscalarMatrix, 0);
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::LDLTscalarMatrix::LDLTscalarMatrix()
+	:
+	comm_(Pstream::worldComm),
+	n_(0)
+{}
+
+
+tnbLib::LDLTscalarMatrix::LDLTscalarMatrix
+(
+	const lduMatrix& ldum,
+	const FieldField<Field, scalar>& interfaceCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces
+)
+	:
+	comm_(ldum.mesh().comm()),
+	n_(0)
+{
+	factorise(ldum, interfaceCoeffs, interfaces);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::LDLTscalarMatrix::append
+(
+	DynamicList<label>& rows,
+	DynamicList<label>& columns,
+	DynamicList<scalar>& values,
+	const label row,
+	const label column,
+	const scalar value
+) const
+{
+	if (row >= column)
+	{
+		rows.append(row);
+		columns.append(column);
+		values.append(value);
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::assemble
+(
+	const lduMatrix& ldum,
+	const FieldField<Field, scalar>& interfaceCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	DynamicList<label>& rows,
+	DynamicList<label>& columns,
+	DynamicList<scalar>& values
+)
+{
+	const labelUList& u = ldum.lduAddr().upperAddr();
+	const labelUList& l = ldum.lduAddr().lowerAddr();
+
+	const scalarField& diag = ldum.diag();
+	const scalarField& upper = ldum.upper();
+	const scalarField& lower = ldum.lower();
+
+	forAll(diag, cell)
+	{
+		append(rows, columns, values, cell, cell, diag[cell]);
+	}
+
+	forAll(upper, face)
+	{
+		append(rows, columns, values, u[face], l[face], lower[face]);
+		append(rows, columns, values, l[face], u[face], upper[face]);
+	}
+
+	forAll(interfaces, inti)
+	{
+		if (interfaces.set(inti))
+		{
+			const lduInterface& interface = interfaces[inti].interface();
+
+			// Assume any interfaces are cyclic ones
+
+			const labelUList& faceCells = interface.faceCells();
+
+			const cyclicLduInterface& cycInterface =
+				refCast<const cyclicLduInterface>(interface);
+			const label nbrInt = cycInterface.neighbPatchID();
+			const labelUList& nbrFaceCells =
+				interfaces[nbrInt].interface().faceCells();
+
+			const scalarField& nbrUpperLower = interfaceCoeffs[nbrInt];
+
+			forAll(faceCells, face)
+			{
+				append
+				(
+					rows,
+					columns,
+					values,
+					faceCells[face],
+					nbrFaceCells[face],
+					-nbrUpperLower[face]
+				);
+			}
+		}
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::assemble
+(
+	const PtrList<procLduMatrix>& lduMatrices,
+	DynamicList<label>& rows,
+	DynamicList<label>& columns,
+	DynamicList<scalar>& values
+)
+{
+	procOffsets_.setSize(lduMatrices.size() + 1);
+	procOffsets_[0] = 0;
+
+	forAll(lduMatrices, ldumi)
+	{
+		procOffsets_[ldumi + 1] = procOffsets_[ldumi] + lduMatrices[ldumi].size();
+	}
+
+	forAll(lduMatrices, ldumi)
+	{
+		const procLduMatrix& lduMatrixi = lduMatrices[ldumi];
+		const label offset = procOffsets_[ldumi];
+
+		const labelList& u = lduMatrixi.upperAddr_;
+		const labelList& l = lduMatrixi.lowerAddr_;
+
+		forAll(lduMatrixi.diag_, cell)
+		{
+			append
+			(
+				rows,
+				columns,
+				values,
+				cell + offset,
+				cell + offset,
+				lduMatrixi.diag_[cell]
+			);
+		}
+
+		forAll(lduMatrixi.upper_, face)
+		{
+			append
+			(
+				rows,
+				columns,
+				values,
+				u[face] + offset,
+				l[face] + offset,
+				lduMatrixi.lower_[face]
+			);
+			append
+			(
+				rows,
+				columns,
+				values,
+				l[face] + offset,
+				u[face] + offset,
+				lduMatrixi.upper_[face]
+			);
+		}
+
+		const PtrList<procLduInterface>& interfaces =
+			lduMatrixi.interfaces_;
+
+		forAll(interfaces, inti)
+		{
+			const procLduInterface& interface = interfaces[inti];
+
+			if (interface.myProcNo_ == interface.neighbProcNo_)
+			{
+				const labelList& ul = interface.faceCells_;
+				const scalarField& upperLower = interface.coeffs_;
+
+				const label inFaces = ul.size()/2;
+
+				for (label face = 0; face < inFaces; face++)
+				{
+					const label uCell = ul[face] + offset;
+					const label lCell = ul[face + inFaces] + offset;
+
+					append
+					(
+						rows,
+						columns,
+						values,
+						uCell,
+						lCell,
+						-upperLower[face + inFaces]
+					);
+					append
+					(
+						rows,
+						columns,
+						values,
+						lCell,
+						uCell,
+						-upperLower[face]
+					);
+				}
+			}
+			else if (interface.myProcNo_ < interface.neighbProcNo_)
+			{
+				// Interface to neighbour proc. Find on neighbour proc the
+				// corresponding interface, also comparing the communication
+				// tag to distinguish multiple interfaces between the two
+				// processors
+
+				const PtrList<procLduInterface>& neiInterfaces =
+					lduMatrices[interface.neighbProcNo_].interfaces_;
+
+				label neiInterfacei = -1;
+
+				forAll(neiInterfaces, ninti)
+				{
+					if
+						(
+							neiInterfaces[ninti].neighbProcNo_
+						 == interface.myProcNo_
+						 && neiInterfaces[ninti].tag_ == interface.tag_
+							)
+					{
+						neiInterfacei = ninti;
+						break;
+					}
+				}
+
+				if (neiInterfacei == -1)
+				{
+					FatalErrorInFunction << exit(FatalError);
+				}
+
+				const procLduInterface& neiInterface =
+					neiInterfaces[neiInterfacei];
+
+				const labelList& uCells = interface.faceCells_;
+				const labelList& lCells = neiInterface.faceCells_;
+
+				const scalarField& upper = interface.coeffs_;
+				const scalarField& lower = neiInterface.coeffs_;
+
+				const label neiOffset = procOffsets_[interface.neighbProcNo_];
+
+				forAll(uCells, face)
+				{
+					const label uCell = uCells[face] + offset;
+					const label lCell = lCells[face] + neiOffset;
+
+					append(rows, columns, values, uCell, lCell, -lower[face]);
+					append(rows, columns, values, lCell, uCell, -upper[face]);
+				}
+			}
+		}
+	}
+}
+
+
+tnbLib::label tnbLib::LDLTscalarMatrix::levelStructure
+(
+	const labelList& adjStart,
+	const labelList& adj,
+	const labelList& subset,
+	const label root,
+	const labelList& mark,
+	const label stamp,
+	labelList& level,
+	DynamicList<label>& reached
+) const
+{
+	forAll(subset, i)
+	{
+		level[subset[i]] = -1;
+	}
+
+	reached.clear();
+	reached.append(root);
+	level[root] = 0;
+
+	label nLevels = 1;
+
+	for (label i = 0; i < reached.size(); i++)
+	{
+		const label row = reached[i];
+
+		for (label p = adjStart[row]; p < adjStart[row + 1]; p++)
+		{
+			const label nbr = adj[p];
+
+			if (mark[nbr] == stamp && level[nbr] < 0)
+			{
+				level[nbr] = level[row] + 1;
+				nLevels = level[nbr] + 1;
+				reached.append(nbr);
+			}
+		}
+	}
+
+	return nLevels;
+}
+
+
+void tnbLib::LDLTscalarMatrix::dissect
+(
+	const labelList& adjStart,
+	const labelList& adj,
+	const labelList& subset,
+	labelList& mark,
+	label& stamp,
+	labelList& level,
+	DynamicList<label>& order
+) const
+{
+	// Split the subset into its connected components and order each of them
+
+	const label componentStamp = ++stamp;
+
+	forAll(subset, i)
+	{
+		mark[subset[i]] = componentStamp;
+	}
+
+	labelList componentRows(subset.size());
+	label nComponentRows = 0;
+
+	forAll(subset, i)
+	{
+		const label root = subset[i];
+
+		if (mark[root] != componentStamp)
+		{
+			continue;
+		}
+
+		const label start = nComponentRows;
+
+		componentRows[nComponentRows++] = root;
+		mark[root] = -1;
+
+		for (label j = start; j < nComponentRows; j++)
+		{
+			const label row = componentRows[j];
+
+			for (label p = adjStart[row]; p < adjStart[row + 1]; p++)
+			{
+				const label nbr = adj[p];
+
+				if (mark[nbr] == componentStamp)
+				{
+					componentRows[nComponentRows++] = nbr;
+					mark[nbr] = -1;
+				}
+			}
+		}
+
+		dissectConnected
+		(
+			adjStart,
+			adj,
+			labelList
+			(
+				SubList<label>
+				(
+					componentRows,
+					nComponentRows - start,
+					start
+				)
+			),
+			mark,
+			stamp,
+			level,
+			order
+		);
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::dissectConnected
+(
+	const labelList& adjStart,
+	const labelList& adj,
+	const labelList& subset,
+	labelList& mark,
+	label& stamp,
+	labelList& level,
+	DynamicList<label>& order
+) const
+{
+	// Subsets below this size are not dissected further
+	static const label minSubsetSize = 16;
+
+	if (subset.size() <= minSubsetSize)
+	{
+		order.append(subset);
+		return;
+	}
+
+	const label subsetStamp = ++stamp;
+
+	forAll(subset, i)
+	{
+		mark[subset[i]] = subsetStamp;
+	}
+
+	// Find a pseudo-peripheral root: repeatedly restart from a row of
+	// minimum degree in the last level while the number of levels grows
+
+	DynamicList<label> reached(subset.size());
+
+	label root = subset[0];
+	label nLevels = levelStructure
+	(
+		adjStart,
+		adj,
+		subset,
+		root,
+		mark,
+		subsetStamp,
+		level,
+		reached
+	);
+
+	for (label iter = 0; iter < 8; iter++)
+	{
+		label candidate = -1;
+		label minDegree = labelMax;
+
+		for
+			(
+				label i = reached.size() - 1;
+				i >= 0 && level[reached[i]] == nLevels - 1;
+				i--
+				)
+		{
+			const label row = reached[i];
+			const label degree = adjStart[row + 1] - adjStart[row];
+
+			if (degree < minDegree)
+			{
+				candidate = row;
+				minDegree = degree;
+			}
+		}
+
+		const label nCandidateLevels = levelStructure
+		(
+			adjStart,
+			adj,
+			subset,
+			candidate,
+			mark,
+			subsetStamp,
+			level,
+			reached
+		);
+
+		if (nCandidateLevels <= nLevels)
+		{
+			break;
+		}
+
+		root = candidate;
+		nLevels = nCandidateLevels;
+	}
+
+	nLevels = levelStructure
+	(
+		adjStart,
+		adj,
+		subset,
+		root,
+		mark,
+		subsetStamp,
+		level,
+		reached
+	);
+
+	if (nLevels < 3)
+	{
+		order.append(subset);
+		return;
+	}
+
+	// Split at the middle level. Rows of the middle level not connected to
+	// the next level are moved to the first part to thin the separator.
+
+	const label middle = nLevels/2;
+
+	DynamicList<label> part0(subset.size()/2);
+	DynamicList<label> part1(subset.size()/2);
+	DynamicList<label> separator;
+
+	forAll(subset, i)
+	{
+		const label row = subset[i];
+
+		if (level[row] < middle)
+		{
+			part0.append(row);
+		}
+		else if (level[row] > middle)
+		{
+			part1.append(row);
+		}
+		else
+		{
+			bool connected = false;
+
+			for (label p = adjStart[row]; p < adjStart[row + 1]; p++)
+			{
+				const label nbr = adj[p];
+
+				if (mark[nbr] == subsetStamp && level[nbr] == middle + 1)
+				{
+					connected = true;
+					break;
+				}
+			}
+
+			if (connected)
+			{
+				separator.append(row);
+			}
+			else
+			{
+				part0.append(row);
+			}
+		}
+	}
+
+	// Order the parts before the separator so that the separator rows are
+	// eliminated last
+	dissect(adjStart, adj, part0, mark, stamp, level, order);
+	dissect(adjStart, adj, part1, mark, stamp, level, order);
+	order.append(separator);
+}
+
+
+void tnbLib::LDLTscalarMatrix::symbolic()
+{
+	// Symmetric adjacency of the off-diagonal entries
+
+	labelList adjStart(n_ + 1, 0);
+
+	forAll(entryRows_, e)
+	{
+		if (entryRows_[e] != entryColumns_[e])
+		{
+			adjStart[entryRows_[e] + 1]++;
+			adjStart[entryColumns_[e] + 1]++;
+		}
+	}
+
+	for (label row = 0; row < n_; row++)
+	{
+		adjStart[row + 1] += adjStart[row];
+	}
+
+	labelList adj(adjStart[n_]);
+
+	{
+		labelList nNbrs(n_, 0);
+
+		forAll(entryRows_, e)
+		{
+			const label row = entryRows_[e];
+			const label column = entryColumns_[e];
+
+			if (row != column)
+			{
+				adj[adjStart[row] + nNbrs[row]++] = column;
+				adj[adjStart[column] + nNbrs[column]++] = row;
+			}
+		}
+	}
+
+
+	// Fill-reducing ordering
+
+	{
+		DynamicList<label> order(n_);
+		labelList mark(n_, -1);
+		labelList level(n_, -1);
+		label stamp = 0;
+
+		dissect(adjStart, adj, identity(n_), mark, stamp, level, order);
+
+		perm_.transfer(order);
+	}
+
+	iperm_.setSize(n_);
+
+	forAll(perm_, i)
+	{
+		iperm_[perm_[i]] = i;
+	}
+
+
+	// Columns of the upper triangle of the permuted matrix
+
+	Ap_.setSize(n_ + 1);
+	Ap_ = 0;
+
+	forAll(entryRows_, e)
+	{
+		Ap_
+		[
+			max(iperm_[entryRows_[e]], iperm_[entryColumns_[e]]) + 1
+		]++;
+	}
+
+	for (label k = 0; k < n_; k++)
+	{
+		Ap_[k + 1] += Ap_[k];
+	}
+
+	Ai_.setSize(Ap_[n_]);
+	entrySlots_.setSize(entryRows_.size());
+
+	{
+		labelList nEntries(n_, 0);
+
+		forAll(entryRows_, e)
+		{
+			const label i = iperm_[entryRows_[e]];
+			const label j = iperm_[entryColumns_[e]];
+			const label k = max(i, j);
+
+			entrySlots_[e] = Ap_[k] + nEntries[k]++;
+			Ai_[entrySlots_[e]] = min(i, j);
+		}
+	}
+
+
+	// Elimination tree and number of coefficients in each column of L
+
+	parent_.setSize(n_);
+
+	labelList flag(n_);
+	labelList Lnz(n_);
+
+	for (label k = 0; k < n_; k++)
+	{
+		parent_[k] = -1;
+		flag[k] = k;
+		Lnz[k] = 0;
+
+		for (label p = Ap_[k]; p < Ap_[k + 1]; p++)
+		{
+			for (label i = Ai_[p]; flag[i] != k; i = parent_[i])
+			{
+				if (parent_[i] == -1)
+				{
+					parent_[i] = k;
+				}
+
+				Lnz[i]++;
+				flag[i] = k;
+			}
+		}
+	}
+
+	Lp_.setSize(n_ + 1);
+	Lp_[0] = 0;
+
+	for (label k = 0; k < n_; k++)
+	{
+		Lp_[k + 1] = Lp_[k] + Lnz[k];
+	}
+
+	Li_.setSize(Lp_[n_]);
+	Lx_.setSize(Lp_[n_]);
+	D_.setSize(n_);
+
+	if (debug)
+	{
+		Pout << "LDLTscalarMatrix::symbolic : size:" << n_
+			<< " nnz(A):" << Ai_.size()
+			<< " nnz(L):" << Li_.size()
+			<< endl;
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::numeric()
+{
+	// Coefficients of the upper triangle of the permuted matrix
+	scalarField Ax(Ai_.size(), 0);
+
+	forAll(entryValues_, e)
+	{
+		Ax[entrySlots_[e]] += entryValues_[e];
+	}
+
+	scalarField Y(n_, 0);
+	labelList pattern(n_);
+	labelList flag(n_);
+	labelList Lnz(n_);
+
+	for (label k = 0; k < n_; k++)
+	{
+		// Scatter column k of A into Y and find the pattern of row k of L
+		// by traversing the elimination tree
+
+		Y[k] = 0;
+		label top = n_;
+		flag[k] = k;
+		Lnz[k] = 0;
+
+		for (label p = Ap_[k]; p < Ap_[k + 1]; p++)
+		{
+			label i = Ai_[p];
+			Y[i] += Ax[p];
+
+			label len = 0;
+
+			for (; flag[i] != k; i = parent_[i])
+			{
+				pattern[len++] = i;
+				flag[i] = k;
+			}
+
+			while (len > 0)
+			{
+				pattern[--top] = pattern[--len];
+			}
+		}
+
+		// Compute row k of L and D[k]
+
+		D_[k] = Y[k];
+		Y[k] = 0;
+
+		for (; top < n_; top++)
+		{
+			const label i = pattern[top];
+			const scalar yi = Y[i];
+			Y[i] = 0;
+
+			const label p2 = Lp_[i] + Lnz[i];
+
+			for (label p = Lp_[i]; p < p2; p++)
+			{
+				Y[Li_[p]] -= Lx_[p]*yi;
+			}
+
+			const scalar lki = yi/D_[i];
+			D_[k] -= lki*yi;
+
+			Li_[p2] = k;
+			Lx_[p2] = lki;
+			Lnz[i]++;
+		}
+
+		if (D_[k] == 0)
+		{
+			FatalErrorInFunction
+				<< "Zero pivot in row " << perm_[k]
+				<< " of the matrix of size " << n_
+				<< exit(FatalError);
+		}
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::backSubstitute(scalarField& x) const
+{
+	scalarField b(n_);
+
+	forAll(b, i)
+	{
+		b[i] = x[perm_[i]];
+	}
+
+	// Solve L y = b
+	for (label j = 0; j < n_; j++)
+	{
+		const scalar bj = b[j];
+
+		for (label p = Lp_[j]; p < Lp_[j + 1]; p++)
+		{
+			b[Li_[p]] -= Lx_[p]*bj;
+		}
+	}
+
+	// Solve D z = y
+	for (label j = 0; j < n_; j++)
+	{
+		b[j] /= D_[j];
+	}
+
+	// Solve L^T x = z
+	for (label j = n_ - 1; j >= 0; j--)
+	{
+		scalar bj = b[j];
+
+		for (label p = Lp_[j]; p < Lp_[j + 1]; p++)
+		{
+			bj -= Lx_[p]*b[Li_[p]];
+		}
+
+		b[j] = bj;
+	}
+
+	forAll(b, i)
+	{
+		x[perm_[i]] = b[i];
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::LDLTscalarMatrix::factorise
+(
+	const lduMatrix& ldum,
+	const FieldField<Field, scalar>& interfaceCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces
+)
+{
+	comm_ = ldum.mesh().comm();
+
+	DynamicList<label> rows;
+	DynamicList<label> columns;
+	DynamicList<scalar> values;
+
+	label n = 0;
+
+	if (Pstream::parRun())
+	{
+		if (Pstream::master(comm_))
+		{
+			PtrList<procLduMatrix> lduMatrices(Pstream::nProcs(comm_));
+
+			label lduMatrixi = 0;
+
+			lduMatrices.set
+			(
+				lduMatrixi++,
+				new procLduMatrix
+				(
+					ldum,
+					interfaceCoeffs,
+					interfaces
+				)
+			);
+
+			for
+				(
+					int slave = Pstream::firstSlave();
+					slave <= Pstream::lastSlave(comm_);
+					slave++
+					)
+			{
+				lduMatrices.set
+				(
+					lduMatrixi++,
+					new procLduMatrix
+					(
+						IPstream
+						(
+							Pstream::commsTypes::scheduled,
+							slave,
+							0,          // bufSize
+							Pstream::msgType(),
+							comm_
+						)()
+					)
+				);
+			}
+
+			forAll(lduMatrices, i)
+			{
+				n += lduMatrices[i].size();
+			}
+
+			assemble(lduMatrices, rows, columns, values);
+		}
+		else
+		{
+			OPstream toMaster
+			(
+				Pstream::commsTypes::scheduled,
+				Pstream::masterNo(),
+				0,              // bufSize
+				Pstream::msgType(),
+				comm_
+			);
+			procLduMatrix cldum
+			(
+				ldum,
+				interfaceCoeffs,
+				interfaces
+			);
+			toMaster << cldum;
+		}
+	}
+	else
+	{
+		n = ldum.lduAddr().size();
+		assemble(ldum, interfaceCoeffs, interfaces, rows, columns, values);
+	}
+
+	if (!Pstream::master(comm_))
+	{
+		return;
+	}
+
+	if (n != n_ || rows != entryRows_ || columns != entryColumns_)
+	{
+		n_ = n;
+		entryRows_.transfer(rows);
+		entryColumns_.transfer(columns);
+		entryValues_.transfer(values);
+
+		symbolic();
+		numeric();
+	}
+	else if (values != entryValues_)
+	{
+		entryValues_.transfer(values);
+
+		numeric();
+	}
+	else if (debug)
+	{
+		Pout << "LDLTscalarMatrix::factorise : "
+			<< "reusing the factorisation of size " << n_ << endl;
+	}
+}
+
+
+void tnbLib::LDLTscalarMatrix::solve
+(
+	scalarField& x,
+	const scalarField& source
+) const
+{
+	// If x and source are different initialize x = source
+	if (&x != &source)
+	{
+		x = source;
+	}
+
+	if (Pstream::parRun())
+	{
+		scalarField X(n_);
+
+		if (Pstream::master(comm_))
+		{
+			scalarField::subField
+			(
+				X,
+				x.size()
+			) = x;
+
+			for
+				(
+					int slave = Pstream::firstSlave();
+					slave <= Pstream::lastSlave(comm_);
+					slave++
+					)
+			{
+				IPstream::read
+				(
+					Pstream::commsTypes::scheduled,
+					slave,
+					reinterpret_cast<char*>
+					(
+						&(X[procOffsets_[slave]])
+						),
+						(procOffsets_[slave + 1] - procOffsets_[slave])*sizeof(scalar),
+					Pstream::msgType(),
+					comm_
+				);
+			}
+		}
+		else
+		{
+			OPstream::write
+			(
+				Pstream::commsTypes::scheduled,
+				Pstream::masterNo(),
+				reinterpret_cast<const char*>(x.begin()),
+				x.byteSize(),
+				Pstream::msgType(),
+				comm_
+			);
+		}
+
+		if (Pstream::master(comm_))
+		{
+			backSubstitute(X);
+
+			x = scalarField::subField
+			(
+				X,
+				x.size()
+			);
+
+			for
+				(
+					int slave = Pstream::firstSlave();
+					slave <= Pstream::lastSlave(comm_);
+					slave++
+					)
+			{
+				OPstream::write
+				(
+					Pstream::commsTypes::scheduled,
+					slave,
+					reinterpret_cast<const char*>
+					(
+						&(X[procOffsets_[slave]])
+						),
+						(procOffsets_[slave + 1] - procOffsets_[slave])*sizeof(scalar),
+					Pstream::msgType(),
+					comm_
+				);
+			}
+		}
+		else
+		{
+			IPstream::read
+			(
+				Pstream::commsTypes::scheduled,
+				Pstream::masterNo(),
+				reinterpret_cast<char*>(x.begin()),
+				x.byteSize(),
+				Pstream::msgType(),
+				comm_
+			);
+		}
+	}
+	else
+	{
+		backSubstitute(x);
+	}
+}
+
+
+// ************************************************************************* //
@@ -79,6 +79,7 @@ namespace tnbLib
 	public:
 
 		friend class LUscalarMatrix;
+		friend class LDLTscalarMatrix;
 
 
 		// Constructors
@@ -1,4 +1,5 @@
 #include <lduMatrix.hxx>
+#include <lduCSRMatrix.hxx>
 
 #include <IOstreams.hxx>
 #include <Switch.hxx>
@@ -13,6 +14,8 @@ namespace tnbLib
 
 const tnbLib::label tnbLib::lduMatrix::solver::defaultMaxIter_ = 1000;
 
+const tnbLib::label tnbLib::lduMatrix::interfacePollSize_ = 10000;
+
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -21,7 +24,9 @@ tnbLib::lduMatrix::lduMatrix(const lduMesh& mesh)
 	lduMesh_(mesh),
 	lowerPtr_(nullptr),
 	diagPtr_(nullptr),
-	upperPtr_(nullptr)
+	upperPtr_(nullptr),
+	csrPtr_(nullptr),
+	interfaceStartRequest_(0)
 {}
 
 
@@ -30,7 +35,9 @@ tnbLib::lduMatrix::lduMatrix(const lduMatrix& A)
 	lduMesh_(A.lduMesh_),
 	lowerPtr_(nullptr),
 	diagPtr_(nullptr),
-	upperPtr_(nullptr)
+	upperPtr_(nullptr),
+	csrPtr_(nullptr),
+	interfaceStartRequest_(0)
 {
 	if (A.lowerPtr_)
 	{
@@ -54,10 +61,14 @@ tnbLib::lduMatrix::lduMatrix(lduMatrix& A, bool reuse)
 	lduMesh_(A.lduMesh_),
 	lowerPtr_(nullptr),
 	diagPtr_(nullptr),
-	upperPtr_(nullptr)
+	upperPtr_(nullptr),
+	csrPtr_(nullptr),
+	interfaceStartRequest_(0)
 {
 	if (reuse)
 	{
+		A.clearCSR();
+
 		if (A.lowerPtr_)
 		{
 			lowerPtr_ = A.lowerPtr_;
@@ -101,7 +112,9 @@ tnbLib::lduMatrix::lduMatrix(const lduMesh& mesh, Istream& is)
 	lduMesh_(mesh),
 	lowerPtr_(nullptr),
 	diagPtr_(nullptr),
-	upperPtr_(nullptr)
+	upperPtr_(nullptr),
+	csrPtr_(nullptr),
+	interfaceStartRequest_(0)
 {
 	Switch hasLow(is);
 	Switch hasDiag(is);
@@ -138,11 +151,15 @@ tnbLib::lduMatrix::~lduMatrix()
 	{
 		delete upperPtr_;
 	}
+
+	clearCSR();
 }
 
 
 tnbLib::scalarField& tnbLib::lduMatrix::lower()
 {
+	clearCSR();
+
 	if (!lowerPtr_)
 	{
 		if (upperPtr_)
@@ -161,6 +178,8 @@ tnbLib::scalarField& tnbLib::lduMatrix::lower()
 
 tnbLib::scalarField& tnbLib::lduMatrix::diag()
 {
+	clearCSR();
+
 	if (!diagPtr_)
 	{
 		diagPtr_ = new scalarField(lduAddr().size(), 0.0);
@@ -172,6 +191,8 @@ tnbLib::scalarField& tnbLib::lduMatrix::diag()
 
 tnbLib::scalarField& tnbLib::lduMatrix::upper()
 {
+	clearCSR();
+
 	if (!upperPtr_)
 	{
 		if (lowerPtr_)
@@ -190,6 +211,8 @@ tnbLib::scalarField& tnbLib::lduMatrix::upper()
 
 tnbLib::scalarField& tnbLib::lduMatrix::lower(const label nCoeffs)
 {
+	clearCSR();
+
 	if (!lowerPtr_)
 	{
 		if (upperPtr_)
@@ -208,6 +231,8 @@ tnbLib::scalarField& tnbLib::lduMatrix::lower(const label nCoeffs)
 
 tnbLib::scalarField& tnbLib::lduMatrix::diag(const label size)
 {
+	clearCSR();
+
 	if (!diagPtr_)
 	{
 		diagPtr_ = new scalarField(size, 0.0);
@@ -219,6 +244,8 @@ tnbLib::scalarField& tnbLib::lduMatrix::diag(const label size)
 
 tnbLib::scalarField& tnbLib::lduMatrix::upper(const label nCoeffs)
 {
+	clearCSR();
+
 	if (!upperPtr_)
 	{
 		if (lowerPtr_)
@@ -288,6 +315,27 @@ const tnbLib::scalarField& tnbLib::lduMatrix::upper() const
 }
 
 
+const tnbLib::lduCSRMatrix& tnbLib::lduMatrix::csr() const
+{
+	if (!csrPtr_)
+	{
+		csrPtr_ = new lduCSRMatrix(*this);
+	}
+
+	return *csrPtr_;
+}
+
+
+void tnbLib::lduMatrix::clearCSR() const
+{
+	if (csrPtr_)
+	{
+		delete csrPtr_;
+		csrPtr_ = nullptr;
+	}
+}
+
+
 // * * * * * * * * * * * * * * * Friend Operators  * * * * * * * * * * * * * //
 
 tnbLib::Ostream& tnbLib::operator<<(Ostream& os, const lduMatrix& ldum)
@@ -1,4 +1,8 @@
 #include <lduMatrix.hxx>
+#include <lduCSRMatrix.hxx>
+#include <threadPool.hxx>
+
+#include <algorithm>
 
 /*---------------------------------------------------------------------------*\
   =========                 |
@@ -27,6 +31,20 @@ Description
 	Multiply a given vector (second argument) by the matrix or its transpose
 	and return the result in the first argument.
 
+	If the addressing is split into more than one thread block the internal
+	coefficients are applied row-by-row by the threads of the threadPool,
+	gathering the face contributions through the owner start and losort
+	addressing.
+
+	If the compressed sparse row copy of the coefficients is cached the
+	internal coefficients of Amul, sumA and residual are applied from it
+	instead.
+
+	In parallel runs with non-blocking communication Amul evaluates the
+	rows of the cells adjacent to the processor interfaces first and the
+	interior rows afterwards, consuming the processor interfaces as soon
+	as their values have been received.
+
 \*---------------------------------------------------------------------------*/
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
@@ -63,19 +81,202 @@ void tnbLib::lduMatrix::Amul
 		cmpt
 	);
 
-	const label nCells = diag().size();
-	for (label cell = 0; cell < nCells; cell++)
+	const label nBlocks = lduAddr().nThreadBlocks();
+
+	// Processor patches the exchange of which is overlapped with the
+	// evaluation of the interior rows
+	const boolList overlapPatches(this->overlapPatches(interfaces));
+
+	if (csrPtr_)
 	{
-		ApsiPtr[cell] = diagPtr[cell] * psiPtr[cell];
+		csrPtr_->Amul(Apsi, psi);
 	}
+	else if (nBlocks > 1)
+	{
+		const label* const __restrict blockStartPtr =
+			lduAddr().threadBlockStartAddr().begin();
+		const label* const __restrict ownStartPtr =
+			lduAddr().ownerStartAddr().begin();
+		const label* const __restrict losortPtr =
+			lduAddr().losortAddr().begin();
+		const label* const __restrict losortStartPtr =
+			lduAddr().losortStartAddr().begin();
+
+		const auto AmulRow = [&](const label cell)
+		{
+			scalar ApsiCell = diagPtr[cell] * psiPtr[cell];
+
+			for
+				(
+					label face = ownStartPtr[cell];
+					face < ownStartPtr[cell + 1];
+					face++
+					)
+			{
+				ApsiCell += upperPtr[face] * psiPtr[uPtr[face]];
+			}
 
+			for
+				(
+					label i = losortStartPtr[cell];
+					i < losortStartPtr[cell + 1];
+					i++
+					)
+			{
+				const label face = losortPtr[i];
+				ApsiCell += lowerPtr[face] * psiPtr[lPtr[face]];
+			}
 
-	const label nFaces = upper().size();
+			ApsiPtr[cell] = ApsiCell;
+		};
+
+		if (overlapPatches.empty())
+		{
+			threadPool::global().parallelFor
+			(
+				nBlocks,
+				[&](const label blocki)
+				{
+					const label cellEnd = blockStartPtr[blocki + 1];
+
+					for
+						(
+							label cell = blockStartPtr[blocki];
+							cell < cellEnd;
+							cell++
+							)
+					{
+						AmulRow(cell);
+					}
+				}
+			);
+		}
+		else
+		{
+			const labelUList& boundaryCells =
+				lduAddr().boundaryCellAddr(overlapPatches);
+			const label* const __restrict bCellPtr = boundaryCells.begin();
+			const label nBoundaryCells = boundaryCells.size();
+
+			// Evaluate the boundary rows first so that the processor
+			// interfaces can be consumed as soon as they have been received
+			for (label i = 0; i < nBoundaryCells; i++)
+			{
+				AmulRow(bCellPtr[i]);
+			}
 
-	for (label face = 0; face < nFaces; face++)
+			pollMatrixInterfaces
+			(
+				interfaceBouCoeffs,
+				interfaces,
+				psi,
+				Apsi,
+				cmpt
+			);
+
+			// Evaluate the interior rows while the exchange is in progress
+			threadPool::global().parallelFor
+			(
+				nBlocks,
+				[&](const label blocki)
+				{
+					const label cellStart = blockStartPtr[blocki];
+					const label cellEnd = blockStartPtr[blocki + 1];
+
+					label bi =
+						std::lower_bound
+						(
+							bCellPtr,
+							bCellPtr + nBoundaryCells,
+							cellStart
+						) - bCellPtr;
+
+					for (label cell = cellStart; cell < cellEnd; cell++)
+					{
+						if (bi < nBoundaryCells && bCellPtr[bi] == cell)
+						{
+							bi++;
+						}
+						else
+						{
+							AmulRow(cell);
+						}
+					}
+				}
+			);
+		}
+	}
+	else
 	{
-		ApsiPtr[uPtr[face]] += lowerPtr[face] * psiPtr[lPtr[face]];
-		ApsiPtr[lPtr[face]] += upperPtr[face] * psiPtr[uPtr[face]];
+		const label nCells = diag().size();
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			ApsiPtr[cell] = diagPtr[cell] * psiPtr[cell];
+		}
+
+
+		const label nFaces = upper().size();
+
+		if (overlapPatches.empty())
+		{
+			for (label face = 0; face < nFaces; face++)
+			{
+				ApsiPtr[uPtr[face]] += lowerPtr[face] * psiPtr[lPtr[face]];
+				ApsiPtr[lPtr[face]] += upperPtr[face] * psiPtr[uPtr[face]];
+			}
+		}
+		else
+		{
+			const labelUList& boundaryFaces =
+				lduAddr().boundaryFaceAddr(overlapPatches);
+			const label* const __restrict bFacePtr = boundaryFaces.begin();
+			const label nBoundaryFaces = boundaryFaces.size();
+
+			// Complete the boundary rows first so that the processor
+			// interfaces can be consumed as soon as they have been received
+			for (label i = 0; i < nBoundaryFaces; i++)
+			{
+				const label face = bFacePtr[i];
+				ApsiPtr[uPtr[face]] += lowerPtr[face] * psiPtr[lPtr[face]];
+				ApsiPtr[lPtr[face]] += upperPtr[face] * psiPtr[uPtr[face]];
+			}
+
+			// Evaluate the interior faces in chunks, consuming the processor
+			// interfaces received in the meantime between the chunks
+			label bi = 0;
+
+			for
+				(
+					label faceStart = 0;
+					faceStart < nFaces;
+					faceStart += interfacePollSize_
+					)
+			{
+				pollMatrixInterfaces
+				(
+					interfaceBouCoeffs,
+					interfaces,
+					psi,
+					Apsi,
+					cmpt
+				);
+
+				const label faceEnd = min(faceStart + interfacePollSize_, nFaces);
+
+				for (label face = faceStart; face < faceEnd; face++)
+				{
+					if (bi < nBoundaryFaces && bFacePtr[bi] == face)
+					{
+						bi++;
+					}
+					else
+					{
+						ApsiPtr[uPtr[face]] += lowerPtr[face] * psiPtr[lPtr[face]];
+						ApsiPtr[lPtr[face]] += upperPtr[face] * psiPtr[uPtr[face]];
+					}
+				}
+			}
+		}
 	}
 
 	// Update interface interfaces
@@ -124,17 +325,75 @@ void tnbLib::lduMatrix::Tmul
 		cmpt
 	);
 
-	const label nCells = diag().size();
-	for (label cell = 0; cell < nCells; cell++)
+	const label nBlocks = lduAddr().nThreadBlocks();
+
+	if (nBlocks > 1)
 	{
-		TpsiPtr[cell] = diagPtr[cell] * psiPtr[cell];
+		const label* const __restrict blockStartPtr =
+			lduAddr().threadBlockStartAddr().begin();
+		const label* const __restrict ownStartPtr =
+			lduAddr().ownerStartAddr().begin();
+		const label* const __restrict losortPtr =
+			lduAddr().losortAddr().begin();
+		const label* const __restrict losortStartPtr =
+			lduAddr().losortStartAddr().begin();
+
+		threadPool::global().parallelFor
+		(
+			nBlocks,
+			[&](const label blocki)
+			{
+				const label cellEnd = blockStartPtr[blocki + 1];
+
+				for
+					(
+						label cell = blockStartPtr[blocki];
+						cell < cellEnd;
+						cell++
+						)
+				{
+					scalar TpsiCell = diagPtr[cell] * psiPtr[cell];
+
+					for
+						(
+							label face = ownStartPtr[cell];
+							face < ownStartPtr[cell + 1];
+							face++
+							)
+					{
+						TpsiCell += lowerPtr[face] * psiPtr[uPtr[face]];
+					}
+
+					for
+						(
+							label i = losortStartPtr[cell];
+							i < losortStartPtr[cell + 1];
+							i++
+							)
+					{
+						const label face = losortPtr[i];
+						TpsiCell += upperPtr[face] * psiPtr[lPtr[face]];
+					}
+
+					TpsiPtr[cell] = TpsiCell;
+				}
+			}
+		);
 	}
-
-	const label nFaces = upper().size();
-	for (label face = 0; face < nFaces; face++)
+	else
 	{
-		TpsiPtr[uPtr[face]] += upperPtr[face] * psiPtr[lPtr[face]];
-		TpsiPtr[lPtr[face]] += lowerPtr[face] * psiPtr[uPtr[face]];
+		const label nCells = diag().size();
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			TpsiPtr[cell] = diagPtr[cell] * psiPtr[cell];
+		}
+
+		const label nFaces = upper().size();
+		for (label face = 0; face < nFaces; face++)
+		{
+			TpsiPtr[uPtr[face]] += upperPtr[face] * psiPtr[lPtr[face]];
+			TpsiPtr[lPtr[face]] += lowerPtr[face] * psiPtr[uPtr[face]];
+		}
 	}
 
 	// Update interface interfaces
@@ -171,15 +430,76 @@ void tnbLib::lduMatrix::sumA
 	const label nCells = diag().size();
 	const label nFaces = upper().size();
 
-	for (label cell = 0; cell < nCells; cell++)
+	const label nBlocks = lduAddr().nThreadBlocks();
+
+	if (csrPtr_)
 	{
-		sumAPtr[cell] = diagPtr[cell];
+		csrPtr_->sumA(sumA);
 	}
-
-	for (label face = 0; face < nFaces; face++)
+	else if (nBlocks > 1)
 	{
-		sumAPtr[uPtr[face]] += lowerPtr[face];
-		sumAPtr[lPtr[face]] += upperPtr[face];
+		const label* const __restrict blockStartPtr =
+			lduAddr().threadBlockStartAddr().begin();
+		const label* const __restrict ownStartPtr =
+			lduAddr().ownerStartAddr().begin();
+		const label* const __restrict losortPtr =
+			lduAddr().losortAddr().begin();
+		const label* const __restrict losortStartPtr =
+			lduAddr().losortStartAddr().begin();
+
+		threadPool::global().parallelFor
+		(
+			nBlocks,
+			[&](const label blocki)
+			{
+				const label cellEnd = blockStartPtr[blocki + 1];
+
+				for
+					(
+						label cell = blockStartPtr[blocki];
+						cell < cellEnd;
+						cell++
+						)
+				{
+					scalar sumACell = diagPtr[cell];
+
+					for
+						(
+							label face = ownStartPtr[cell];
+							face < ownStartPtr[cell + 1];
+							face++
+							)
+					{
+						sumACell += upperPtr[face];
+					}
+
+					for
+						(
+							label i = losortStartPtr[cell];
+							i < losortStartPtr[cell + 1];
+							i++
+							)
+					{
+						sumACell += lowerPtr[losortPtr[i]];
+					}
+
+					sumAPtr[cell] = sumACell;
+				}
+			}
+		);
+	}
+	else
+	{
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			sumAPtr[cell] = diagPtr[cell];
+		}
+
+		for (label face = 0; face < nFaces; face++)
+		{
+			sumAPtr[uPtr[face]] += lowerPtr[face];
+			sumAPtr[lPtr[face]] += upperPtr[face];
+		}
 	}
 
 	// Add the interface internal coefficients to diagonal
@@ -253,19 +573,81 @@ void tnbLib::lduMatrix::residual
 		cmpt
 	);
 
-	const label nCells = diag().size();
-	for (label cell = 0; cell < nCells; cell++)
+	const label nBlocks = lduAddr().nThreadBlocks();
+
+	if (csrPtr_)
 	{
-		rAPtr[cell] = sourcePtr[cell] - diagPtr[cell] * psiPtr[cell];
+		csrPtr_->residual(rA, psi, source);
+	}
+	else if (nBlocks > 1)
+	{
+		const label* const __restrict blockStartPtr =
+			lduAddr().threadBlockStartAddr().begin();
+		const label* const __restrict ownStartPtr =
+			lduAddr().ownerStartAddr().begin();
+		const label* const __restrict losortPtr =
+			lduAddr().losortAddr().begin();
+		const label* const __restrict losortStartPtr =
+			lduAddr().losortStartAddr().begin();
+
+		threadPool::global().parallelFor
+		(
+			nBlocks,
+			[&](const label blocki)
+			{
+				const label cellEnd = blockStartPtr[blocki + 1];
+
+				for
+					(
+						label cell = blockStartPtr[blocki];
+						cell < cellEnd;
+						cell++
+						)
+				{
+					scalar rACell = sourcePtr[cell] - diagPtr[cell] * psiPtr[cell];
+
+					for
+						(
+							label face = ownStartPtr[cell];
+							face < ownStartPtr[cell + 1];
+							face++
+							)
+					{
+						rACell -= upperPtr[face] * psiPtr[uPtr[face]];
+					}
+
+					for
+						(
+							label i = losortStartPtr[cell];
+							i < losortStartPtr[cell + 1];
+							i++
+							)
+					{
+						const label face = losortPtr[i];
+						rACell -= lowerPtr[face] * psiPtr[lPtr[face]];
+					}
+
+					rAPtr[cell] = rACell;
+				}
+			}
+		);
 	}
+	else
+	{
+		const label nCells = diag().size();
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			rAPtr[cell] = sourcePtr[cell] - diagPtr[cell] * psiPtr[cell];
+		}
 
 
-	const label nFaces = upper().size();
+		const label nFaces = upper().size();
 
-	for (label face = 0; face < nFaces; face++)
-	{
-		rAPtr[uPtr[face]] -= lowerPtr[face] * psiPtr[lPtr[face]];
-		rAPtr[lPtr[face]] -= upperPtr[face] * psiPtr[uPtr[face]];
+		for (label face = 0; face < nFaces; face++)
+		{
+			rAPtr[uPtr[face]] -= lowerPtr[face] * psiPtr[lPtr[face]];
+			rAPtr[lPtr[face]] -= upperPtr[face] * psiPtr[uPtr[face]];
+		}
 	}
 
 	// Update interface interfaces
@@ -110,6 +110,8 @@ void tnbLib::lduMatrix::operator=(const lduMatrix& A)
 			<< abort(FatalError);
 	}
 
+	clearCSR();
+
 	if (A.lowerPtr_)
 	{
 		lower() = A.lower();
@@ -139,6 +141,8 @@ void tnbLib::lduMatrix::operator=(const lduMatrix& A)
 
 void tnbLib::lduMatrix::negate()
 {
+	clearCSR();
+
 	if (lowerPtr_)
 	{
 		lowerPtr_->negate();
@@ -316,6 +320,8 @@ void tnbLib::lduMatrix::operator-=(const lduMatrix& A)
 
 void tnbLib::lduMatrix::operator*=(const scalarField& sf)
 {
+	clearCSR();
+
 	if (diagPtr_)
 	{
 		*diagPtr_ *= sf;
@@ -346,6 +352,8 @@ void tnbLib::lduMatrix::operator*=(const scalarField& sf)
 
 void tnbLib::lduMatrix::operator*=(scalar s)
 {
+	clearCSR();
+
 	if (diagPtr_)
 	{
 		*diagPtr_ *= s;
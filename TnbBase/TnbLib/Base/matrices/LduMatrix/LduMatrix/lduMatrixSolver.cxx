@@ -1,6 +1,7 @@
 #include <lduMatrix.hxx>
 
 #include <diagonalSolver.hxx>
+#include <reduceBatch.hxx>
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -137,6 +138,31 @@ void tnbLib::lduMatrix::solver::readControls()
 	minIter_ = controlDict_.lookupOrDefault<label>("minIter", 0);
 	tolerance_ = controlDict_.lookupOrDefault<scalar>("tolerance", 1e-6);
 	relTol_ = controlDict_.lookupOrDefault<scalar>("relTol", 0);
+
+	const word matrixFormat
+	(
+		controlDict_.lookupOrDefault<word>("matrixFormat", "LDU")
+	);
+
+	if (matrixFormat == "CSR")
+	{
+		// Diagonal matrices are solved directly without matrix products
+		if (matrix_.symmetric() || matrix_.asymmetric())
+		{
+			matrix_.csr();
+		}
+	}
+	else if (matrixFormat == "LDU")
+	{
+		matrix_.clearCSR();
+	}
+	else
+	{
+		FatalIOErrorInFunction(controlDict_)
+			<< "Unknown matrixFormat " << matrixFormat << nl
+			<< "Valid matrix formats are : LDU CSR"
+			<< exit(FatalIOError);
+	}
 }
 
 
@@ -173,4 +199,53 @@ tnbLib::scalar tnbLib::lduMatrix::solver::normFactor
 }
 
 
+tnbLib::scalar tnbLib::lduMatrix::solver::normalisedResidual
+(
+	const scalarField& psi,
+	const scalarField& source,
+	const scalarField& Apsi,
+	const scalarField& rA,
+	scalarField& tmpField,
+	scalar& normFactor
+) const
+{
+	const label comm = matrix_.lduMesh_.comm();
+
+	// --- Start the reduction for the reference value of psi
+	reduceBatch psiBatch(comm);
+	const reduceBatch::future sumPsi = psiBatch.sum(sum(psi));
+	const reduceBatch::future nPsi = psiBatch.sum(scalar(psi.size()));
+	psiBatch.start();
+
+	// --- Calculate A dot one while the reduction is in flight
+	matrix_.sumA(tmpField, interfaceBouCoeffs_, interfaces_);
+
+	const scalar n = nPsi.value();
+
+	if (n > 0)
+	{
+		tmpField *= sumPsi.value()/n;
+	}
+	else
+	{
+		WarningInFunction
+			<< "empty field, returning zero." << endl;
+
+		tmpField = Zero;
+	}
+
+	// --- Reduce the norm and the residual together
+	reduceBatch normBatch(comm);
+	const reduceBatch::future norm = normBatch.sum
+	(
+		sum((mag(Apsi - tmpField) + mag(source - tmpField))())
+	);
+	const reduceBatch::future residual = normBatch.sum(sumMag(rA));
+
+	normFactor = norm.value() + solverPerformance::small_;
+
+	return residual.value()/normFactor;
+}
+
+
 // ************************************************************************* //
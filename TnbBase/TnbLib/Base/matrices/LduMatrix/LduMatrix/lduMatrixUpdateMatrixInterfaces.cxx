@@ -1,7 +1,77 @@
 #include <lduMatrix.hxx>
+#include <processorLduInterfaceField.hxx>
 
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
 
+tnbLib::boolList tnbLib::lduMatrix::overlapPatches
+(
+	const lduInterfaceFieldPtrsList& interfaces
+) const
+{
+	boolList patches(interfaces.size(), false);
+	bool overlap = false;
+
+	if
+		(
+			Pstream::parRun()
+			&& Pstream::defaultCommsType == Pstream::commsTypes::nonBlocking
+			)
+	{
+		forAll(interfaces, interfacei)
+		{
+			if
+				(
+					interfaces.set(interfacei)
+					&& isA<processorLduInterfaceField>(interfaces[interfacei])
+					)
+			{
+				patches[interfacei] = true;
+				overlap = true;
+			}
+		}
+	}
+
+	if (!overlap)
+	{
+		patches.clear();
+	}
+
+	return patches;
+}
+
+
+void tnbLib::lduMatrix::pollMatrixInterfaces
+(
+	const FieldField<Field, scalar>& coupleCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	const scalarField& psiif,
+	scalarField& result,
+	const direction cmpt
+) const
+{
+	forAll(interfaces, interfacei)
+	{
+		if
+			(
+				interfaces.set(interfacei)
+				&& isA<processorLduInterfaceField>(interfaces[interfacei])
+				&& !interfaces[interfacei].updatedMatrix()
+				&& interfaces[interfacei].ready()
+				)
+		{
+			interfaces[interfacei].updateInterfaceMatrix
+			(
+				result,
+				psiif,
+				coupleCoeffs[interfacei],
+				cmpt,
+				Pstream::defaultCommsType
+			);
+		}
+	}
+}
+
+
 void tnbLib::lduMatrix::initMatrixInterfaces
 (
 	const FieldField<Field, scalar>& coupleCoeffs,
@@ -11,6 +81,8 @@ void tnbLib::lduMatrix::initMatrixInterfaces
 	const direction cmpt
 ) const
 {
+	interfaceStartRequest_ = UPstream::nRequests();
+
 	if
 		(
 			Pstream::defaultCommsType == Pstream::commsTypes::blocking
@@ -139,17 +211,14 @@ void tnbLib::lduMatrix::updateMatrixInterfaces
 		{
 			if (allUpdated)
 			{
-				// All received. Just remove all storage of requests
-				// Note that we don't know what starting number of requests
-				// was before start of sends and receives (since set from
-				// initMatrixInterfaces) so set to 0 and loose any in-flight
-				// requests.
-				UPstream::resetRequests(0);
+				// All received. Just remove the storage of the requests
+				// started by initMatrixInterfaces
+				UPstream::resetRequests(interfaceStartRequest_);
 			}
 			else
 			{
-				// Block for all requests and remove storage
-				UPstream::waitRequests();
+				// Block for the interface requests and remove storage
+				UPstream::waitRequests(interfaceStartRequest_);
 			}
 		}
 
@@ -0,0 +1,96 @@
+#include <ChebyshevPreconditioner.hxx>
+
+#include <ChebyshevSmoother.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(ChebyshevPreconditioner, 0);
+
+	lduMatrix::preconditioner::
+		addsymMatrixConstructorToTable<ChebyshevPreconditioner>
+		addChebyshevPreconditionerSymMatrixConstructorToTable_;
+
+	lduMatrix::preconditioner::
+		addasymMatrixConstructorToTable<ChebyshevPreconditioner>
+		addChebyshevPreconditionerAsymMatrixConstructorToTable_;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::ChebyshevPreconditioner::ChebyshevPreconditioner
+(
+	const lduMatrix::solver& sol,
+	const dictionary& solverControls
+)
+	:
+	lduMatrix::preconditioner(sol),
+	rD_(1.0/sol.matrix().diag()),
+	degree_(solverControls.lookupOrDefault<label>("degree", 4)),
+	eigenvalueRatio_
+	(
+		solverControls.lookupOrDefault<scalar>
+		(
+			"eigenvalueRatio",
+			ChebyshevSmoother::eigenvalueRatio
+		)
+	),
+	lambdaMax_
+	(
+		ChebyshevSmoother::eigenvalueBoost
+	   *ChebyshevSmoother::estimateMaxEigenvalue
+		(
+			sol.matrix(),
+			sol.interfaceBouCoeffs(),
+			sol.interfaces(),
+			rD_,
+			solverControls.lookupOrDefault<label>
+			(
+				"nEigenIters",
+				ChebyshevSmoother::nEigenIters
+			),
+			0
+		)
+	)
+{
+	if (degree_ < 1 || eigenvalueRatio_ <= 1)
+	{
+		FatalIOErrorInFunction(solverControls)
+			<< "degree " << degree_ << " must be at least 1 and "
+			<< "eigenvalueRatio " << eigenvalueRatio_
+			<< " must be greater than 1"
+			<< exit(FatalIOError);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::ChebyshevPreconditioner::precondition
+(
+	scalarField& wA,
+	const scalarField& rA,
+	const direction cmpt
+) const
+{
+	wA = 0.0;
+
+	ChebyshevSmoother::smooth
+	(
+		wA,
+		solver_.matrix(),
+		rA,
+		solver_.interfaceBouCoeffs(),
+		solver_.interfaces(),
+		rD_,
+		lambdaMax_/eigenvalueRatio_,
+		lambdaMax_,
+		cmpt,
+		degree_
+	);
+}
+
+
+// ************************************************************************* //
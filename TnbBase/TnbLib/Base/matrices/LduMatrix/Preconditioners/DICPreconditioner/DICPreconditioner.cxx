@@ -1,5 +1,7 @@
 #include <DICPreconditioner.hxx>
 
+#include <lduLevelSchedule.hxx>
+
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
 namespace tnbLib
@@ -70,13 +72,69 @@ void tnbLib::DICPreconditioner::precondition
 	const scalar* __restrict rAPtr = rA.begin();
 	const scalar* __restrict rDPtr = rD_.begin();
 
-	const label* const __restrict uPtr =
-		solver_.matrix().lduAddr().upperAddr().begin();
-	const label* const __restrict lPtr =
-		solver_.matrix().lduAddr().lowerAddr().begin();
+	const lduAddressing& addr = solver_.matrix().lduAddr();
+
+	const label* const __restrict uPtr = addr.upperAddr().begin();
+	const label* const __restrict lPtr = addr.lowerAddr().begin();
 	const scalar* const __restrict upperPtr =
 		solver_.matrix().upper().begin();
 
+	if (addr.nThreadBlocks() > 1)
+	{
+		// Level-scheduled sweeps gathering the face contributions of each
+		// row in the order of the serial face sweeps
+		const label* const __restrict ownStartPtr =
+			addr.ownerStartAddr().begin();
+		const label* const __restrict losortPtr = addr.losortAddr().begin();
+		const label* const __restrict losortStartPtr =
+			addr.losortStartAddr().begin();
+
+		const lduLevelSchedule& schedule = addr.levelSchedule();
+
+		schedule.forwardSweep
+		(
+			[&](const label cell)
+			{
+				scalar wACell = rDPtr[cell] * rAPtr[cell];
+
+				for
+					(
+						label i = losortStartPtr[cell];
+						i < losortStartPtr[cell + 1];
+						i++
+						)
+				{
+					const label face = losortPtr[i];
+					wACell -= rDPtr[cell] * upperPtr[face] * wAPtr[lPtr[face]];
+				}
+
+				wAPtr[cell] = wACell;
+			}
+		);
+
+		schedule.backwardSweep
+		(
+			[&](const label cell)
+			{
+				scalar wACell = wAPtr[cell];
+
+				for
+					(
+						label face = ownStartPtr[cell + 1] - 1;
+						face >= ownStartPtr[cell];
+						face--
+						)
+				{
+					wACell -= rDPtr[cell] * upperPtr[face] * wAPtr[uPtr[face]];
+				}
+
+				wAPtr[cell] = wACell;
+			}
+		);
+
+		return;
+	}
+
 	label nCells = wA.size();
 	label nFaces = solver_.matrix().upper().size();
 	label nFacesM1 = nFaces - 1;
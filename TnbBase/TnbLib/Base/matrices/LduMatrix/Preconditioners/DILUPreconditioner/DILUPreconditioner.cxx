@@ -1,5 +1,7 @@
 #include <DILUPreconditioner.hxx>
 
+#include <lduLevelSchedule.hxx>
+
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
 namespace tnbLib
@@ -83,6 +85,63 @@ void tnbLib::DILUPreconditioner::precondition
 	const scalar* const __restrict lowerPtr =
 		solver_.matrix().lower().begin();
 
+	const lduAddressing& addr = solver_.matrix().lduAddr();
+
+	if (addr.nThreadBlocks() > 1)
+	{
+		// Level-scheduled sweeps gathering the face contributions of each
+		// row in the order of the serial face sweeps
+		const label* const __restrict ownStartPtr =
+			addr.ownerStartAddr().begin();
+		const label* const __restrict losortStartPtr =
+			addr.losortStartAddr().begin();
+
+		const lduLevelSchedule& schedule = addr.levelSchedule();
+
+		schedule.forwardSweep
+		(
+			[&](const label cell)
+			{
+				scalar wACell = rDPtr[cell] * rAPtr[cell];
+
+				for
+					(
+						label i = losortStartPtr[cell];
+						i < losortStartPtr[cell + 1];
+						i++
+						)
+				{
+					const label sface = losortPtr[i];
+					wACell -= rDPtr[cell] * lowerPtr[sface] * wAPtr[lPtr[sface]];
+				}
+
+				wAPtr[cell] = wACell;
+			}
+		);
+
+		schedule.backwardSweep
+		(
+			[&](const label cell)
+			{
+				scalar wACell = wAPtr[cell];
+
+				for
+					(
+						label face = ownStartPtr[cell + 1] - 1;
+						face >= ownStartPtr[cell];
+						face--
+						)
+				{
+					wACell -= rDPtr[cell] * upperPtr[face] * wAPtr[uPtr[face]];
+				}
+
+				wAPtr[cell] = wACell;
+			}
+		);
+
+		return;
+	}
+
 	label nCells = wA.size();
 	label nFaces = solver_.matrix().upper().size();
 	label nFacesM1 = nFaces - 1;
@@ -89,6 +89,11 @@ void tnbLib::GAMGPreconditioner::precondition
 		finestCorrectionScratch
 	);
 
+	// Measure the convergence rate of the V-cycles of the first
+	// preconditioning of the solution, which controls the reuse of the
+	// coarse levels as the rate of GAMGSolver::solve does
+	const bool measureRate = rate_ < 0;
+
 	for (label cycle = 0; cycle < nVcycles_; cycle++)
 	{
 		Vcycle
@@ -112,7 +117,7 @@ void tnbLib::GAMGPreconditioner::precondition
 			cmpt
 		);
 
-		if (cycle < nVcycles_ - 1)
+		if (cycle < nVcycles_ - 1 || measureRate)
 		{
 			// Calculate finest level residual field
 			matrix_.Amul(AwA, wA, interfaceBouCoeffs_, interfaces_, cmpt);
@@ -120,6 +125,21 @@ void tnbLib::GAMGPreconditioner::precondition
 			finestResidual -= AwA;
 		}
 	}
+
+	if (measureRate)
+	{
+		const label comm = matrix().mesh().comm();
+		const scalar initialResidual = gSumMag(rA, comm);
+
+		if (initialResidual > small)
+		{
+			rate_ = pow
+			(
+				gSumMag(finestResidual, comm)/initialResidual,
+				1.0/nVcycles_
+			);
+		}
+	}
 }
 
 
@@ -14,6 +14,7 @@
     makeLduAsymPreconditioner(DiagonalPreconditioner, Type, DType, LUType);    \
                                                                                \
     makeLduPreconditioner(TDILUPreconditioner, Type, DType, LUType);           \
+    makeLduSymPreconditioner(TDILUPreconditioner, Type, DType, LUType);        \
     makeLduAsymPreconditioner(TDILUPreconditioner, Type, DType, LUType);
 
 namespace tnbLib
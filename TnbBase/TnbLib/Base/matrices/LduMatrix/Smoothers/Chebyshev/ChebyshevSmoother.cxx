@@ -0,0 +1,361 @@
+#include <ChebyshevSmoother.hxx>
+
+#include <DynamicList.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(ChebyshevSmoother, 0);
+
+	lduMatrix::smoother::addsymMatrixConstructorToTable<ChebyshevSmoother>
+		addChebyshevSmootherSymMatrixConstructorToTable_;
+
+	lduMatrix::smoother::addasymMatrixConstructorToTable<ChebyshevSmoother>
+		addChebyshevSmootherAsymMatrixConstructorToTable_;
+}
+
+const tnbLib::label tnbLib::ChebyshevSmoother::nEigenIters = 10;
+
+const tnbLib::scalar tnbLib::ChebyshevSmoother::eigenvalueBoost = 1.1;
+
+const tnbLib::scalar tnbLib::ChebyshevSmoother::eigenvalueRatio = 30;
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+tnbLib::scalar tnbLib::ChebyshevSmoother::maxEigenvalue
+(
+	const scalarList& diag,
+	const scalarList& offDiag
+)
+{
+	const label n = diag.size();
+
+	// Gershgorin bounds of the spectrum
+	scalar lower = great;
+	scalar upper = -great;
+
+	for (label i = 0; i < n; i++)
+	{
+		const scalar radius =
+			(i > 0 ? mag(offDiag[i - 1]) : 0)
+		  + (i < n - 1 ? mag(offDiag[i]) : 0);
+
+		lower = min(lower, diag[i] - radius);
+		upper = max(upper, diag[i] + radius);
+	}
+
+	// Bisection for the largest eigenvalue using the Sturm sequence count
+	// of the eigenvalues smaller than x
+	for
+		(
+			label iter = 0;
+			iter < 100 && upper - lower > small*mag(upper);
+			iter++
+			)
+	{
+		const scalar x = 0.5*(lower + upper);
+
+		label nSmaller = 0;
+		scalar q = 1;
+
+		for (label i = 0; i < n; i++)
+		{
+			q = diag[i] - x - (i > 0 ? sqr(offDiag[i - 1])/q : 0);
+
+			if (mag(q) < vSmall)
+			{
+				q = -vSmall;
+			}
+
+			if (q < 0)
+			{
+				nSmaller++;
+			}
+		}
+
+		if (nSmaller == n)
+		{
+			upper = x;
+		}
+		else
+		{
+			lower = x;
+		}
+	}
+
+	return upper;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::ChebyshevSmoother::ChebyshevSmoother
+(
+	const word& fieldName,
+	const lduMatrix& matrix,
+	const FieldField<Field, scalar>& interfaceBouCoeffs,
+	const FieldField<Field, scalar>& interfaceIntCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces
+)
+	:
+	lduMatrix::smoother
+	(
+		fieldName,
+		matrix,
+		interfaceBouCoeffs,
+		interfaceIntCoeffs,
+		interfaces
+	),
+	rD_(1.0/matrix_.diag()),
+	lambdaMax_(-1)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::scalar tnbLib::ChebyshevSmoother::estimateMaxEigenvalue
+(
+	const lduMatrix& matrix,
+	const FieldField<Field, scalar>& interfaceBouCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	const scalarField& rD,
+	const label nIters,
+	const direction cmpt
+)
+{
+	const label nCells = rD.size();
+	const label comm = matrix.mesh().comm();
+
+	// Start vector with components of varying magnitude so that it is not
+	// orthogonal to the high-frequency eigenvectors
+	scalarField rA(nCells);
+	forAll(rA, celli)
+	{
+		rA[celli] = 1.0 + ((celli*7919) % 1009)/1009.0;
+	}
+
+	scalarField wA(nCells);
+	scalarField pA(nCells, 0.0);
+	scalarField qA(nCells);
+
+	if (matrix.symmetric())
+	{
+		// Jacobi-preconditioned conjugate gradient iterations from which
+		// the Lanczos tridiagonal matrix of D^-1 A is assembled
+		DynamicList<scalar> diag(nIters);
+		DynamicList<scalar> offDiag(nIters);
+
+		scalar wArA = great;
+		scalar alphaOld = 0;
+
+		for (label iter = 0; iter < nIters; iter++)
+		{
+			wA = rD*rA;
+
+			const scalar wArAold = wArA;
+			wArA = gSumProd(wA, rA, comm);
+
+			if (wArA < vSmall)
+			{
+				break;
+			}
+
+			const scalar beta = iter ? wArA/wArAold : 0;
+
+			pA = wA + beta*pA;
+
+			matrix.Amul(qA, pA, interfaceBouCoeffs, interfaces, cmpt);
+
+			const scalar pAqA = gSumProd(pA, qA, comm);
+
+			if (pAqA < vSmall)
+			{
+				break;
+			}
+
+			const scalar alpha = wArA/pAqA;
+
+			if (iter)
+			{
+				diag.append(1.0/alpha + beta/alphaOld);
+				offDiag.append(sqrt(beta)/alphaOld);
+			}
+			else
+			{
+				diag.append(1.0/alpha);
+			}
+
+			rA -= alpha*qA;
+			alphaOld = alpha;
+		}
+
+		if (diag.size())
+		{
+			return maxEigenvalue(diag, offDiag);
+		}
+	}
+	else
+	{
+		// Power iterations of D^-1 A
+		scalar lambda = 0;
+
+		wA = rA/sqrt(gSumSqr(rA, comm));
+
+		for (label iter = 0; iter < nIters; iter++)
+		{
+			matrix.Amul(qA, wA, interfaceBouCoeffs, interfaces, cmpt);
+			qA *= rD;
+
+			lambda = sqrt(gSumSqr(qA, comm));
+
+			if (lambda < vSmall)
+			{
+				break;
+			}
+
+			wA = qA/lambda;
+		}
+
+		if (lambda > vSmall)
+		{
+			return lambda;
+		}
+	}
+
+	// Bound of the spectrum of a diagonally dominant matrix
+	return 2;
+}
+
+
+void tnbLib::ChebyshevSmoother::smooth
+(
+	scalarField& psi,
+	const lduMatrix& matrix,
+	const scalarField& source,
+	const FieldField<Field, scalar>& interfaceBouCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	const scalarField& rD,
+	const scalar lambdaMin,
+	const scalar lambdaMax,
+	const direction cmpt,
+	const label degree
+)
+{
+	// Centre and half-width of the damped interval
+	const scalar theta = 0.5*(lambdaMax + lambdaMin);
+	const scalar delta = 0.5*(lambdaMax - lambdaMin);
+	const scalar sigma = theta/delta;
+
+	scalar rho = 1.0/sigma;
+
+	const label nCells = psi.size();
+
+	scalarField rA(nCells);
+	scalarField dA(nCells);
+
+	scalar* __restrict psiPtr = psi.begin();
+	scalar* __restrict dAPtr = dA.begin();
+	const scalar* const __restrict rAPtr = rA.begin();
+	const scalar* const __restrict rDPtr = rD.begin();
+
+	for (label k = 0; k < degree; k++)
+	{
+		matrix.residual
+		(
+			rA,
+			psi,
+			source,
+			interfaceBouCoeffs,
+			interfaces,
+			cmpt
+		);
+
+		if (k == 0)
+		{
+			const scalar rFactor = 1.0/theta;
+
+			for (label celli = 0; celli < nCells; celli++)
+			{
+				dAPtr[celli] = rFactor*rDPtr[celli]*rAPtr[celli];
+			}
+		}
+		else
+		{
+			const scalar rhoNew = 1.0/(2*sigma - rho);
+			const scalar dFactor = rhoNew*rho;
+			const scalar rFactor = 2*rhoNew/delta;
+
+			for (label celli = 0; celli < nCells; celli++)
+			{
+				dAPtr[celli] =
+					dFactor*dAPtr[celli] + rFactor*rDPtr[celli]*rAPtr[celli];
+			}
+
+			rho = rhoNew;
+		}
+
+		for (label celli = 0; celli < nCells; celli++)
+		{
+			psiPtr[celli] += dAPtr[celli];
+		}
+	}
+}
+
+
+tnbLib::scalar tnbLib::ChebyshevSmoother::lambdaMax() const
+{
+	if (lambdaMax_ < 0)
+	{
+		lambdaMax_ =
+			eigenvalueBoost
+		   *estimateMaxEigenvalue
+			(
+				matrix_,
+				interfaceBouCoeffs_,
+				interfaces_,
+				rD_,
+				nEigenIters,
+				0
+			);
+
+		if (debug)
+		{
+			Info << typeName << ": field " << fieldName_
+				<< ", nCells " << returnReduce(rD_.size(), sumOp<label>())
+				<< ", lambdaMax " << lambdaMax_ << endl;
+		}
+	}
+
+	return lambdaMax_;
+}
+
+
+void tnbLib::ChebyshevSmoother::smooth
+(
+	scalarField& psi,
+	const scalarField& source,
+	const direction cmpt,
+	const label nSweeps
+) const
+{
+	const scalar lambdaMax = this->lambdaMax();
+
+	smooth
+	(
+		psi,
+		matrix_,
+		source,
+		interfaceBouCoeffs_,
+		interfaces_,
+		rD_,
+		lambdaMax/eigenvalueRatio,
+		lambdaMax,
+		cmpt,
+		nSweeps
+	);
+}
+
+
+// ************************************************************************* //
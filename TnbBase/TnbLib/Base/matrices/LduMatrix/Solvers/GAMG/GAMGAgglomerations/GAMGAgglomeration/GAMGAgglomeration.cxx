@@ -7,6 +7,7 @@
 #include <GAMGProcAgglomeration.hxx>
 #include <pairGAMGAgglomeration.hxx>
 #include <IOmanip.hxx>
+#include <taskParallel.hxx>
 
 #include <PstreamReduceOps.hxx>  // added by amir
 
@@ -262,6 +263,9 @@ const tnbLib::GAMGAgglomeration& tnbLib::GAMGAgglomeration::New
 	const dictionary& controlDict
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			!mesh.thisDb().foundObject<GAMGAgglomeration>
@@ -317,6 +321,9 @@ const tnbLib::GAMGAgglomeration& tnbLib::GAMGAgglomeration::New
 {
 	const lduMesh& mesh = matrix.mesh();
 
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			!mesh.thisDb().foundObject<GAMGAgglomeration>
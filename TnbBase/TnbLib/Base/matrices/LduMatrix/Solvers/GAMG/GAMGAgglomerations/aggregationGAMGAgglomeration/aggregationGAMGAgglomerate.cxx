@@ -0,0 +1,451 @@
+#include <aggregationGAMGAgglomeration.hxx>
+
+#include <lduAddressing.hxx>
+#include <IOmanip.hxx>
+#include <PstreamReduceOps.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::aggregationGAMGAgglomeration::agglomerate
+(
+	const scalarField& diag,
+	const scalarField& offDiag
+)
+{
+	// Start the aggregation from the given matrix coefficients
+	scalarField* diagPtr = const_cast<scalarField*>(&diag);
+	scalarField* offDiagPtr = const_cast<scalarField*>(&offDiag);
+
+	label nCreatedLevels = 0;
+
+	while (nCreatedLevels < maxLevels_ - 1)
+	{
+		label nCoarseCells = -1;
+
+		tmp<labelField> finalAgglomPtr = agglomerate
+		(
+			nCoarseCells,
+			meshLevel(nCreatedLevels).lduAddr(),
+			*diagPtr,
+			*offDiagPtr
+		);
+
+		if (continueAgglomerating(finalAgglomPtr().size(), nCoarseCells))
+		{
+			nCells_[nCreatedLevels] = nCoarseCells;
+			restrictAddressing_.set(nCreatedLevels, finalAgglomPtr);
+		}
+		else
+		{
+			break;
+		}
+
+		agglomerateLduAddressing(nCreatedLevels);
+
+		// Galerkin projection of the coefficients onto the coarse level
+		// with piecewise-constant prolongation
+		{
+			scalarField* coarseDiagPtr
+			(
+				new scalarField(nCells_[nCreatedLevels], 0.0)
+			);
+
+			scalarField* coarseOffDiagPtr
+			(
+				new scalarField
+				(
+					meshLevels_[nCreatedLevels].upperAddr().size(),
+					0.0
+				)
+			);
+
+			restrictField(*coarseDiagPtr, *diagPtr, nCreatedLevels, false);
+
+			// Faces internal to an aggregate contribute to its diagonal
+			const labelList& faceRestrictAddr =
+				faceRestrictAddressing_[nCreatedLevels];
+
+			forAll(faceRestrictAddr, facei)
+			{
+				const label cFace = faceRestrictAddr[facei];
+
+				if (cFace < 0)
+				{
+					(*coarseDiagPtr)[-1 - cFace] += 2*(*offDiagPtr)[facei];
+				}
+			}
+
+			restrictFaceField
+			(
+				*coarseOffDiagPtr,
+				*offDiagPtr,
+				nCreatedLevels
+			);
+
+			if (nCreatedLevels)
+			{
+				delete diagPtr;
+				delete offDiagPtr;
+			}
+
+			diagPtr = coarseDiagPtr;
+			offDiagPtr = coarseOffDiagPtr;
+		}
+
+		nCreatedLevels++;
+	}
+
+	// Shrink the storage of the levels to those created
+	compactLevels(nCreatedLevels);
+
+	// Delete temporary coefficient storage
+	if (nCreatedLevels)
+	{
+		delete diagPtr;
+		delete offDiagPtr;
+	}
+}
+
+
+tnbLib::tmp<tnbLib::labelField> tnbLib::aggregationGAMGAgglomeration::agglomerate
+(
+	label& nCoarseCells,
+	const lduAddressing& fineMatrixAddressing,
+	const scalarField& diag,
+	const scalarField& offDiag
+) const
+{
+	const label nFineCells = fineMatrixAddressing.size();
+
+	const labelUList& upperAddr = fineMatrixAddressing.upperAddr();
+	const labelUList& lowerAddr = fineMatrixAddressing.lowerAddr();
+
+	// For each cell calculate faces
+	labelList cellFaces(upperAddr.size() + lowerAddr.size());
+	labelList cellFaceOffsets(nFineCells + 1);
+
+	// memory management
+	{
+		labelList nNbrs(nFineCells, 0);
+
+		forAll(upperAddr, facei)
+		{
+			nNbrs[upperAddr[facei]]++;
+		}
+
+		forAll(lowerAddr, facei)
+		{
+			nNbrs[lowerAddr[facei]]++;
+		}
+
+		cellFaceOffsets[0] = 0;
+		forAll(nNbrs, celli)
+		{
+			cellFaceOffsets[celli + 1] = cellFaceOffsets[celli] + nNbrs[celli];
+		}
+
+		// reset the whole list to use as counter
+		nNbrs = 0;
+
+		forAll(upperAddr, facei)
+		{
+			cellFaces
+				[
+					cellFaceOffsets[upperAddr[facei]] + nNbrs[upperAddr[facei]]
+				] = facei;
+
+			nNbrs[upperAddr[facei]]++;
+		}
+
+		forAll(lowerAddr, facei)
+		{
+			cellFaces
+				[
+					cellFaceOffsets[lowerAddr[facei]] + nNbrs[lowerAddr[facei]]
+				] = facei;
+
+			nNbrs[lowerAddr[facei]]++;
+		}
+	}
+
+
+	// Strength of connection of the faces
+	scalarField strength(upperAddr.size());
+
+	forAll(strength, facei)
+	{
+		strength[facei] =
+			mag(offDiag[facei])
+			/max
+			(
+				sqrt(mag(diag[lowerAddr[facei]]*diag[upperAddr[facei]])),
+				vSmall
+			);
+	}
+
+
+	tmp<labelField> tcoarseCellMap(new labelField(nFineCells, -1));
+	labelField& coarseCellMap = tcoarseCellMap.ref();
+
+	// Number of fine cells in each aggregate
+	DynamicList<label> aggregateSize(nFineCells/coarseningRatio_ + 1);
+
+	nCoarseCells = 0;
+
+
+	// Pass 1: seed aggregates on unaggregated cells and grow them by the
+	// strongest unaggregated strong neighbours
+
+	for (label celli = 0; celli < nFineCells; celli++)
+	{
+		if (coarseCellMap[celli] >= 0)
+		{
+			continue;
+		}
+
+		label nMembers = 1;
+
+		while (nMembers < coarseningRatio_)
+		{
+			label matchCelli = -1;
+			scalar maxStrength = strengthThreshold_;
+
+			for
+				(
+					label faceOs = cellFaceOffsets[celli];
+					faceOs < cellFaceOffsets[celli + 1];
+					faceOs++
+					)
+			{
+				const label facei = cellFaces[faceOs];
+
+				const label nbrCelli =
+					upperAddr[facei] == celli
+				  ? lowerAddr[facei]
+				  : upperAddr[facei];
+
+				if
+					(
+						coarseCellMap[nbrCelli] < 0
+						&& strength[facei] >= maxStrength
+						)
+				{
+					matchCelli = nbrCelli;
+					maxStrength = strength[facei];
+				}
+			}
+
+			if (matchCelli < 0)
+			{
+				break;
+			}
+
+			if (nMembers == 1)
+			{
+				coarseCellMap[celli] = nCoarseCells;
+			}
+
+			coarseCellMap[matchCelli] = nCoarseCells;
+			nMembers++;
+		}
+
+		if (nMembers > 1)
+		{
+			aggregateSize.append(nMembers);
+			nCoarseCells++;
+		}
+	}
+
+
+	// Pass 2: join remaining cells to the neighbouring aggregate to which
+	// they are most strongly connected
+
+	const label maxAggregateSize = 2*coarseningRatio_;
+
+	for (label celli = 0; celli < nFineCells; celli++)
+	{
+		if (coarseCellMap[celli] >= 0)
+		{
+			continue;
+		}
+
+		label matchCoarseCelli = -1;
+		scalar maxStrength = strengthThreshold_;
+
+		for
+			(
+				label faceOs = cellFaceOffsets[celli];
+				faceOs < cellFaceOffsets[celli + 1];
+				faceOs++
+				)
+		{
+			const label facei = cellFaces[faceOs];
+
+			const label nbrCoarseCelli =
+				coarseCellMap
+				[
+					upperAddr[facei] == celli
+				  ? lowerAddr[facei]
+				  : upperAddr[facei]
+				];
+
+			if
+				(
+					nbrCoarseCelli >= 0
+					&& aggregateSize[nbrCoarseCelli] < maxAggregateSize
+					&& strength[facei] >= maxStrength
+					)
+			{
+				matchCoarseCelli = nbrCoarseCelli;
+				maxStrength = strength[facei];
+			}
+		}
+
+		if (matchCoarseCelli >= 0)
+		{
+			coarseCellMap[celli] = matchCoarseCelli;
+			aggregateSize[matchCoarseCelli]++;
+		}
+	}
+
+
+	// Pass 3: aggregate the remaining, weakly connected cells with their
+	// unaggregated neighbours or, failing that, join the aggregate of the
+	// strongest neighbour
+
+	for (label celli = 0; celli < nFineCells; celli++)
+	{
+		if (coarseCellMap[celli] >= 0)
+		{
+			continue;
+		}
+
+		coarseCellMap[celli] = nCoarseCells;
+		label nMembers = 1;
+
+		label matchCoarseCelli = -1;
+		scalar maxStrength = -great;
+
+		for
+			(
+				label faceOs = cellFaceOffsets[celli];
+				faceOs < cellFaceOffsets[celli + 1];
+				faceOs++
+				)
+		{
+			const label facei = cellFaces[faceOs];
+
+			const label nbrCelli =
+				upperAddr[facei] == celli
+			  ? lowerAddr[facei]
+			  : upperAddr[facei];
+
+			if (coarseCellMap[nbrCelli] < 0)
+			{
+				if (nMembers < coarseningRatio_)
+				{
+					coarseCellMap[nbrCelli] = nCoarseCells;
+					nMembers++;
+				}
+			}
+			else if
+				(
+					coarseCellMap[nbrCelli] != nCoarseCells
+					&& strength[facei] > maxStrength
+					)
+			{
+				matchCoarseCelli = coarseCellMap[nbrCelli];
+				maxStrength = strength[facei];
+			}
+		}
+
+		if (nMembers > 1 || matchCoarseCelli < 0)
+		{
+			// New aggregate, possibly a singleton for an isolated cell
+			aggregateSize.append(nMembers);
+			nCoarseCells++;
+		}
+		else
+		{
+			coarseCellMap[celli] = matchCoarseCelli;
+			aggregateSize[matchCoarseCelli]++;
+		}
+	}
+
+	return tcoarseCellMap;
+}
+
+
+void tnbLib::aggregationGAMGAgglomeration::printStatistics() const
+{
+	Info << "aggregationGAMGAgglomeration:" << nl
+		<< "    strengthThreshold : " << strengthThreshold_ << nl
+		<< "    coarseningRatio   : " << coarseningRatio_ << nl
+		<< nl
+		<< setw(8) << "Level"
+		<< setw(12) << "nCells"
+		<< setw(12) << "nFaces"
+		<< setw(12) << "nCoeffs"
+		<< setw(12) << "ratio"
+		<< setw(12) << "complexity"
+		<< nl
+		<< setw(8) << "-----"
+		<< setw(12) << "------"
+		<< setw(12) << "------"
+		<< setw(12) << "-------"
+		<< setw(12) << "-----"
+		<< setw(12) << "----------"
+		<< nl;
+
+	scalar nFineCoeffs = 0;
+	scalar nTotalCoeffs = 0;
+	label nPrevCells = 0;
+
+	for (label levelI = 0; levelI <= size(); levelI++)
+	{
+		label nCells = 0;
+		label nFaces = 0;
+
+		if (hasMeshLevel(levelI))
+		{
+			const lduAddressing& addr = meshLevel(levelI).lduAddr();
+
+			nCells = addr.size();
+			nFaces = addr.lowerAddr().size();
+		}
+
+		const label totNCells = returnReduce(nCells, sumOp<label>());
+		const label totNFaces = returnReduce(nFaces, sumOp<label>());
+
+		// Diagonal and upper and lower triangle coefficients
+		const scalar nCoeffs = scalar(totNCells) + 2*scalar(totNFaces);
+
+		if (levelI == 0)
+		{
+			nFineCoeffs = nCoeffs;
+		}
+
+		nTotalCoeffs += nCoeffs;
+
+		int oldPrecision = Info().precision(4);
+
+		Info << setw(8) << levelI
+			<< setw(12) << totNCells
+			<< setw(12) << totNFaces
+			<< setw(12) << nCoeffs
+			<< setw(12)
+			<< (levelI ? scalar(nPrevCells)/max(totNCells, 1) : 1.0)
+			<< setw(12) << nTotalCoeffs/max(nFineCoeffs, 1.0)
+			<< nl;
+
+		Info().precision(oldPrecision);
+
+		nPrevCells = totNCells;
+	}
+
+	Info << "    operator complexity : "
+		<< nTotalCoeffs/max(nFineCoeffs, 1.0) << nl << endl;
+}
+
+
+// ************************************************************************* //
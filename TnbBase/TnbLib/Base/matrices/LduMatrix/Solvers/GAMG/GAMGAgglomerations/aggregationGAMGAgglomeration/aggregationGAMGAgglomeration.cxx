@@ -0,0 +1,73 @@
+#include <aggregationGAMGAgglomeration.hxx>
+
+#include <lduMatrix.hxx>
+#include <addToRunTimeSelectionTable.hxx>
+
+#include <Switch.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(aggregationGAMGAgglomeration, 0);
+
+	addToRunTimeSelectionTable
+	(
+		GAMGAgglomeration,
+		aggregationGAMGAgglomeration,
+		lduMatrix
+	);
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::aggregationGAMGAgglomeration::aggregationGAMGAgglomeration
+(
+	const lduMatrix& matrix,
+	const dictionary& controlDict
+)
+	:
+	GAMGAgglomeration(matrix.mesh(), controlDict),
+	strengthThreshold_
+	(
+		controlDict.lookupOrDefault<scalar>("strengthThreshold", 0.25)
+	),
+	coarseningRatio_
+	(
+		controlDict.lookupOrDefault<label>("coarseningRatio", 4)
+	),
+	printStatistics_
+	(
+		controlDict.lookupOrDefault<Switch>("printStatistics", false)
+	)
+{
+	if (coarseningRatio_ < 2)
+	{
+		FatalIOErrorInFunction(controlDict)
+			<< "coarseningRatio = " << coarseningRatio_
+			<< " should be at least 2"
+			<< exit(FatalIOError);
+	}
+
+	if (matrix.hasLower())
+	{
+		agglomerate
+		(
+			matrix.diag(),
+			0.5*(matrix.upper() + matrix.lower())
+		);
+	}
+	else
+	{
+		agglomerate(matrix.diag(), matrix.upper());
+	}
+
+	if (printStatistics_ || debug)
+	{
+		printStatistics();
+	}
+}
+
+
+// ************************************************************************* //
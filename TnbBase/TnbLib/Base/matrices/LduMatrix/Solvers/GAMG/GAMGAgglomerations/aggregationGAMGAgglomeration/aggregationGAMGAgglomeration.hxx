@@ -0,0 +1,176 @@
+#pragma once
+#ifndef _aggregationGAMGAgglomeration_Header
+#define _aggregationGAMGAgglomeration_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::aggregationGAMGAgglomeration
+
+Description
+	Algebraic agglomeration by strength-of-connection based aggregation.
+
+	The connection between cells i and j is strong if
+
+	\f[
+		|a_{ij}| \ge \theta \sqrt{|a_{ii} a_{jj}|}
+	\f]
+
+	where \f$\theta\f$ is the strength threshold. Each level is aggregated
+	in three passes:
+	  -# aggregates are seeded on unaggregated cells and grown by their
+		 strongest unaggregated strong neighbours up to the target
+		 coarsening ratio,
+	  -# remaining cells join the neighbouring aggregate to which they are
+		 most strongly connected, up to twice the target coarsening ratio,
+	  -# cells still remaining are aggregated with their unaggregated
+		 neighbours or, failing that, join the aggregate of their strongest
+		 neighbour.
+
+	On anisotropic, e.g. stretched boundary-layer, meshes the aggregates
+	follow the strong couplings, giving semi-coarsening in the direction
+	of the strong coupling.
+
+	The coarse-level coefficients used for the strength of connection are
+	obtained by Galerkin projection with the piecewise-constant
+	prolongation of GAMG, the off-diagonal coefficients being symmetrised.
+
+	The operator complexity, the sum over the levels of the number of
+	matrix coefficients relative to that of the finest level, is reported
+	per level if printStatistics is set.
+
+Usage
+	\verbatim
+	p
+	{
+		solver              GAMG;
+		smoother            GaussSeidel;
+		agglomerator        aggregation;
+		strengthThreshold   0.25;   // Default 0.25
+		coarseningRatio     4;      // Default 4
+		printStatistics     yes;    // Default no
+		tolerance           1e-6;
+		relTol              0.05;
+	}
+	\endverbatim
+
+SourceFiles
+	aggregationGAMGAgglomeration.C
+	aggregationGAMGAgglomerate.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <GAMGAgglomeration.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+						Class aggregationGAMGAgglomeration Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class aggregationGAMGAgglomeration
+		:
+		public GAMGAgglomeration
+	{
+		// Private Data
+
+			//- Strength of connection threshold
+		const scalar strengthThreshold_;
+
+		//- Target number of fine cells per coarse cell
+		const label coarseningRatio_;
+
+		//- Print the per-level statistics and operator complexity
+		const bool printStatistics_;
+
+
+		// Private Member Functions
+
+			//- Agglomerate all levels starting from the given diagonal and
+			//  symmetrised off-diagonal coefficients
+		FoamBase_EXPORT void agglomerate
+		(
+			const scalarField& diag,
+			const scalarField& offDiag
+		);
+
+		//- Calculate and return the agglomeration of a single level
+		FoamBase_EXPORT tmp<labelField> agglomerate
+		(
+			label& nCoarseCells,
+			const lduAddressing& fineMatrixAddressing,
+			const scalarField& diag,
+			const scalarField& offDiag
+		) const;
+
+		//- Print the per-level statistics and operator complexity
+		FoamBase_EXPORT void printStatistics() const;
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("aggregation");
+		static const char* typeName_() { return "aggregation"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct given matrix and controls
+		FoamBase_EXPORT aggregationGAMGAgglomeration
+		(
+			const lduMatrix& matrix,
+			const dictionary& controlDict
+		);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT aggregationGAMGAgglomeration
+		(
+			const aggregationGAMGAgglomeration&
+		) = delete;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=
+		(
+			const aggregationGAMGAgglomeration&
+		) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_aggregationGAMGAgglomeration_Header
@@ -0,0 +1,209 @@
+#include <GAMGCoarseLevels.hxx>
+
+#include <GAMGAgglomeration.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(GAMGCoarseLevels, 0);
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::GAMGCoarseLevels::GAMGCoarseLevels(const lduMesh& mesh)
+	:
+	MeshObject<lduMesh, tnbLib::GeometricMeshObject, GAMGCoarseLevels>(mesh)
+{}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+tnbLib::GAMGCoarseLevels& tnbLib::GAMGCoarseLevels::New(const lduMesh& mesh)
+{
+	if
+		(
+			!mesh.thisDb().foundObject<GAMGCoarseLevels>
+			(
+				GAMGCoarseLevels::typeName
+				)
+			)
+	{
+		return store(new GAMGCoarseLevels(mesh));
+	}
+	else
+	{
+		return const_cast<GAMGCoarseLevels&>
+			(
+				mesh.thisDb().lookupObject<GAMGCoarseLevels>
+				(
+					GAMGCoarseLevels::typeName
+					)
+				);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::autoPtr<tnbLib::GAMGCoarseLevels::fieldLevels>
+tnbLib::GAMGCoarseLevels::retrieve
+(
+	const lduMesh& mesh,
+	const word& fieldName,
+	const GAMGAgglomeration& agglomeration,
+	const bool symmetric,
+	const label maxReuses,
+	const scalar rateFactor
+)
+{
+	GAMGCoarseLevels& cache = New(mesh);
+
+	HashPtrTable<fieldLevels>::iterator iter =
+		cache.fieldLevels_.find(fieldName);
+
+	if (iter == cache.fieldLevels_.end())
+	{
+		return autoPtr<fieldLevels>();
+	}
+
+	autoPtr<fieldLevels> levels(cache.fieldLevels_.remove(iter));
+
+	if (levels->agglomerationPtr != &agglomeration)
+	{
+		if (debug)
+		{
+			Info << "GAMGCoarseLevels: " << fieldName
+				<< ": agglomeration changed, rebuilding coarse levels" << endl;
+		}
+
+		return autoPtr<fieldLevels>();
+	}
+
+	if (levels->symmetric != symmetric)
+	{
+		if (debug)
+		{
+			Info << "GAMGCoarseLevels: " << fieldName
+				<< ": matrix type changed, rebuilding coarse levels" << endl;
+		}
+
+		return autoPtr<fieldLevels>();
+	}
+
+	if (levels->nReuses >= maxReuses)
+	{
+		if (debug)
+		{
+			Info << "GAMGCoarseLevels: " << fieldName
+				<< ": reused " << levels->nReuses
+				<< " times, rebuilding coarse levels" << endl;
+		}
+
+		return autoPtr<fieldLevels>();
+	}
+
+	if
+		(
+			levels->referenceRate > 0
+			&& levels->rate > rateFactor*levels->referenceRate
+			)
+	{
+		if (debug)
+		{
+			Info << "GAMGCoarseLevels: " << fieldName
+				<< ": convergence rate " << levels->rate
+				<< " degraded from " << levels->referenceRate
+				<< ", rebuilding coarse levels" << endl;
+		}
+
+		return autoPtr<fieldLevels>();
+	}
+
+	levels->nReuses++;
+
+	if (debug)
+	{
+		Info << "GAMGCoarseLevels: " << fieldName
+			<< ": reusing coarse levels, reuse " << levels->nReuses
+			<< " of " << maxReuses << endl;
+	}
+
+	return levels;
+}
+
+
+void tnbLib::GAMGCoarseLevels::insert
+(
+	const lduMesh& mesh,
+	const word& fieldName,
+	autoPtr<fieldLevels>& levels
+)
+{
+	GAMGCoarseLevels& cache = New(mesh);
+
+	HashPtrTable<fieldLevels>::iterator iter =
+		cache.fieldLevels_.find(fieldName);
+
+	if (iter != cache.fieldLevels_.end())
+	{
+		cache.fieldLevels_.erase(iter);
+	}
+
+	cache.fieldLevels_.insert(fieldName, levels.ptr());
+}
+
+
+tnbLib::LDLTscalarMatrix& tnbLib::GAMGCoarseLevels::coarsestMatrix
+(
+	const lduMesh& mesh,
+	const word& fieldName
+)
+{
+	GAMGCoarseLevels& cache = New(mesh);
+
+	HashPtrTable<LDLTscalarMatrix>::iterator iter =
+		cache.coarsestMatrices_.find(fieldName);
+
+	if (iter == cache.coarsestMatrices_.end())
+	{
+		LDLTscalarMatrix* matrixPtr = new LDLTscalarMatrix();
+		cache.coarsestMatrices_.insert(fieldName, matrixPtr);
+
+		return *matrixPtr;
+	}
+	else
+	{
+		return *iter();
+	}
+}
+
+
+tnbLib::GAMGCoarseLevels::fieldEigenvalues&
+tnbLib::GAMGCoarseLevels::eigenvalues
+(
+	const lduMesh& mesh,
+	const word& fieldName
+)
+{
+	GAMGCoarseLevels& cache = New(mesh);
+
+	HashPtrTable<fieldEigenvalues>::iterator iter =
+		cache.eigenvalues_.find(fieldName);
+
+	if (iter == cache.eigenvalues_.end())
+	{
+		fieldEigenvalues* eigenvaluesPtr = new fieldEigenvalues();
+		cache.eigenvalues_.insert(fieldName, eigenvaluesPtr);
+
+		return *eigenvaluesPtr;
+	}
+	else
+	{
+		return *iter();
+	}
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,255 @@
+#pragma once
+#ifndef _GAMGCoarseLevels_Header
+#define _GAMGCoarseLevels_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::GAMGCoarseLevels
+
+Description
+	Cache of the GAMG coarse-level matrices, interfaces and interface
+	coefficients of each solved field, held on the mesh so that they
+	survive between the GAMG solvers constructed for each solution.
+
+	A stored set of levels is handed back to the next GAMGSolver of the
+	same field provided that it was created for the same agglomeration and
+	matrix type, that it has been reused fewer than the given number of
+	times and that the average convergence rate of the last solution has
+	not degraded beyond the given factor of that obtained with the freshly
+	agglomerated levels. Otherwise it is deleted and the solver agglomerates
+	a new set.
+
+	It also holds the sparse LDL^T factorisation of the coarsest level of
+	each field, which is kept irrespective of the reuse of the levels so
+	that its symbolic factorisation can be reused when the coarsest-level
+	structure is unchanged, and the estimated largest eigenvalues of the
+	Chebyshev smoothers of the levels of each field.
+
+	The cache is a geometric mesh object and is therefore cleared together
+	with the cached agglomeration when the mesh changes.
+
+SourceFiles
+	GAMGCoarseLevels.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <MeshObject.hxx>
+#include <lduMatrix.hxx>
+#include <LUscalarMatrix.hxx>
+#include <LDLTscalarMatrix.hxx>
+#include <HashPtrTable.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class GAMGAgglomeration;
+
+	/*---------------------------------------------------------------------------*\
+							  Class GAMGCoarseLevels Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class GAMGCoarseLevels
+		:
+		public MeshObject<lduMesh, GeometricMeshObject, GAMGCoarseLevels>
+	{
+	public:
+
+		//- Coarse levels of a single field
+		class fieldLevels
+		{
+		public:
+
+			// Public Data
+
+				//- Agglomeration the levels were created for
+			const GAMGAgglomeration* agglomerationPtr;
+
+			//- Symmetry of the finest-level matrix
+			bool symmetric;
+
+			//- Number of times the levels have been reused
+			label nReuses;
+
+			//- Average convergence rate obtained with the fresh levels
+			scalar referenceRate;
+
+			//- Average convergence rate of the last solution
+			scalar rate;
+
+			//- Hierarchy of matrix levels
+			PtrList<lduMatrix> matrixLevels;
+
+			//- Hierarchy of interfaces
+			PtrList<PtrList<lduInterfaceField>> primitiveInterfaceLevels;
+
+			//- Hierarchy of interfaces in lduInterfaceFieldPtrs form
+			PtrList<lduInterfaceFieldPtrsList> interfaceLevels;
+
+			//- Hierarchy of interface boundary coefficients
+			PtrList<FieldField<Field, scalar>> interfaceLevelsBouCoeffs;
+
+			//- Hierarchy of interface internal coefficients
+			PtrList<FieldField<Field, scalar>> interfaceLevelsIntCoeffs;
+
+			//- LU decompsed coarsest matrix
+			autoPtr<LUscalarMatrix> coarsestLUMatrixPtr;
+
+
+			// Constructors
+
+				//- Construct null
+			fieldLevels()
+				:
+				agglomerationPtr(nullptr),
+				symmetric(false),
+				nReuses(0),
+				referenceRate(-1),
+				rate(-1)
+			{}
+		};
+
+
+		//- Estimated largest eigenvalues of the smoothers of a single field
+		class fieldEigenvalues
+		{
+		public:
+
+			// Public Data
+
+				//- Number of solutions which used the estimates
+			label nSolutions;
+
+			//- Largest eigenvalue of D^-1 A of each level, the finest
+			//  level being level 0, -1 if not estimated
+			scalarList lambdaMax;
+
+
+			// Constructors
+
+				//- Construct null
+			fieldEigenvalues()
+				:
+				nSolutions(0)
+			{}
+		};
+
+
+	private:
+
+		// Private Data
+
+			//- Coarse levels of the fields
+		HashPtrTable<fieldLevels> fieldLevels_;
+
+		//- Sparse factorisations of the coarsest levels of the fields
+		HashPtrTable<LDLTscalarMatrix> coarsestMatrices_;
+
+		//- Estimated largest eigenvalues of the smoothers of the fields
+		HashPtrTable<fieldEigenvalues> eigenvalues_;
+
+
+		// Private Member Functions
+
+			//- Return the cache of the given mesh, constructing it if needed
+		static FoamBase_EXPORT GAMGCoarseLevels& New(const lduMesh& mesh);
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("GAMGCoarseLevels");
+		static const char* typeName_() { return "GAMGCoarseLevels"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct for given mesh
+		FoamBase_EXPORT explicit GAMGCoarseLevels(const lduMesh& mesh);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT GAMGCoarseLevels(const GAMGCoarseLevels&) = delete;
+
+
+		// Member Functions
+
+			//- Remove and return the coarse levels of the given field if
+			//  they may be reused, otherwise delete them and return null
+		static FoamBase_EXPORT autoPtr<fieldLevels> retrieve
+		(
+			const lduMesh& mesh,
+			const word& fieldName,
+			const GAMGAgglomeration& agglomeration,
+			const bool symmetric,
+			const label maxReuses,
+			const scalar rateFactor
+		);
+
+		//- Store the coarse levels of the given field
+		static FoamBase_EXPORT void insert
+		(
+			const lduMesh& mesh,
+			const word& fieldName,
+			autoPtr<fieldLevels>& levels
+		);
+
+
+		//- Return the sparse factorisation of the coarsest level of the
+		//  given field, constructing an empty one if not yet present
+		static FoamBase_EXPORT LDLTscalarMatrix& coarsestMatrix
+		(
+			const lduMesh& mesh,
+			const word& fieldName
+		);
+
+		//- Return the estimated largest eigenvalues of the smoothers of the
+		//  given field, constructing an empty set if not yet present
+		static FoamBase_EXPORT fieldEigenvalues& eigenvalues
+		(
+			const lduMesh& mesh,
+			const word& fieldName
+		);
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const GAMGCoarseLevels&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_GAMGCoarseLevels_Header
@@ -55,16 +55,60 @@ tnbLib::GAMGSolver::GAMGSolver
 	interpolateCorrection_(false),
 	scaleCorrection_(matrix.symmetric()),
 	directSolveCoarsest_(false),
+	sparseDirectSolveCoarsest_(false),
+	reuseCoarseLevels_(0),
+	reuseRateFactor_(1.5),
+	coarseSmootherLevel_(1),
+	eigenvalueInterval_(1),
 	agglomeration_(GAMGAgglomeration::New(matrix_, controlDict_)),
 
 	matrixLevels_(agglomeration_.size()),
 	primitiveInterfaceLevels_(agglomeration_.size()),
 	interfaceLevels_(agglomeration_.size()),
 	interfaceLevelsBouCoeffs_(agglomeration_.size()),
-	interfaceLevelsIntCoeffs_(agglomeration_.size())
+	interfaceLevelsIntCoeffs_(agglomeration_.size()),
+	coarsestLDLTMatrixPtr_(nullptr),
+	nReuses_(0),
+	referenceRate_(-1),
+	rate_(-1),
+	smootherLambdaMax_(agglomeration_.size() + 1, -1.0)
 {
 	readControls();
 
+	const bool coarseLevelsReused = retrieveCoarseLevels();
+
+	if (!coarseLevelsReused)
+	{
+		agglomerateMatrices();
+	}
+
+	if (sparseDirectSolveCoarsest_)
+	{
+		factoriseCoarsestLevel();
+	}
+
+	retrieveSmootherEigenvalues(coarseLevelsReused);
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::GAMGSolver::~GAMGSolver()
+{
+	storeSmootherEigenvalues();
+	storeCoarseLevels();
+
+	if (!cacheAgglomeration_)
+	{
+		delete &agglomeration_;
+	}
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::GAMGSolver::agglomerateMatrices()
+{
 	if (agglomeration_.processorAgglomerate())
 	{
 		forAll(agglomeration_, fineLevelIndex)
@@ -224,10 +268,26 @@ tnbLib::GAMGSolver::GAMGSolver
 		Pout << endl;
 	}
 
+	// Use the matrix format of the finest level on the coarse levels
+	if (matrix_.hasCSR())
+	{
+		forAll(matrixLevels_, leveli)
+		{
+			if
+				(
+					matrixLevels_.set(leveli)
+					&& !matrixLevels_[leveli].diagonal()
+					)
+			{
+				matrixLevels_[leveli].csr();
+			}
+		}
+	}
+
 
 	if (matrixLevels_.size())
 	{
-		if (directSolveCoarsest_)
+		if (directSolveCoarsest_ && !sparseDirectSolveCoarsest_)
 		{
 			const label coarsestLevel = matrixLevels_.size() - 1;
 
@@ -257,19 +317,6 @@ tnbLib::GAMGSolver::GAMGSolver
 }
 
 
-// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
-
-tnbLib::GAMGSolver::~GAMGSolver()
-{
-	if (!cacheAgglomeration_)
-	{
-		delete &agglomeration_;
-	}
-}
-
-
-// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
-
 void tnbLib::GAMGSolver::readControls()
 {
 	lduMatrix::solver::readControls();
@@ -293,6 +340,23 @@ void tnbLib::GAMGSolver::readControls()
 	controlDict_.readIfPresent("interpolateCorrection", interpolateCorrection_);
 	controlDict_.readIfPresent("scaleCorrection", scaleCorrection_);
 	controlDict_.readIfPresent("directSolveCoarsest", directSolveCoarsest_);
+	controlDict_.readIfPresent
+	(
+		"sparseDirectSolveCoarsest",
+		sparseDirectSolveCoarsest_
+	);
+
+	// The LDL^T factorisation is only applicable to symmetric matrices
+	if (!matrix_.symmetric())
+	{
+		sparseDirectSolveCoarsest_ = false;
+	}
+
+	controlDict_.readIfPresent("reuseCoarseLevels", reuseCoarseLevels_);
+	controlDict_.readIfPresent("reuseRateFactor", reuseRateFactor_);
+	controlDict_.readIfPresent("coarseSmoother", coarseSmoother_);
+	controlDict_.readIfPresent("coarseSmootherLevel", coarseSmootherLevel_);
+	controlDict_.readIfPresent("eigenvalueInterval", eigenvalueInterval_);
 
 	if (debug)
 	{
@@ -308,6 +372,12 @@ void tnbLib::GAMGSolver::readControls()
 			<< " interpolateCorrection:" << interpolateCorrection_
 			<< " scaleCorrection:" << scaleCorrection_
 			<< " directSolveCoarsest:" << directSolveCoarsest_
+			<< " sparseDirectSolveCoarsest:" << sparseDirectSolveCoarsest_
+			<< " reuseCoarseLevels:" << reuseCoarseLevels_
+			<< " reuseRateFactor:" << reuseRateFactor_
+			<< " coarseSmoother:" << coarseSmoother_
+			<< " coarseSmootherLevel:" << coarseSmootherLevel_
+			<< " eigenvalueInterval:" << eigenvalueInterval_
 			<< endl;
 	}
 }
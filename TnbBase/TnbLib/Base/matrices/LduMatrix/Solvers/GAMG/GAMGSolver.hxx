@@ -36,18 +36,37 @@ Description
 	  - Agglomeration algorithm: selectable and optionally cached.
 	  - Restriction operator: summation.
 	  - Prolongation operator: injection.
-	  - Smoother: Gauss-Seidel.
+	  - Smoother: selectable, e.g. Gauss-Seidel. With "coarseSmoother" the
+		levels from "coarseSmootherLevel" (default 1, the first coarse
+		level) are smoothed by a different smoother, e.g. the Chebyshev
+		smoother on the fine levels and Gauss-Seidel on the coarse levels.
 	  - Coarse matrix creation: central coefficient: summation of fine grid
 		central coefficients with the removal of intra-cluster face;
 		off-diagonal coefficient: summation of off-diagonal faces.
 	  - Coarse matrix scaling: performed by correction scaling, using steepest
 		descent optimisation.
 	  - Type of cycle: V-cycle with optional pre-smoothing.
-	  - Coarsest-level matrix solved using PCG or PBiCGStab.
+	  - Coarsest-level matrix solved using PCG or PBiCGStab, dense LU
+		decomposition ("directSolveCoarsest yes") or, for symmetric
+		matrices, sparse LDL^T factorisation with nested-dissection
+		ordering ("sparseDirectSolveCoarsest yes"). The sparse factorisation
+		is cached between solutions of the field and only recomputed if
+		the coarsest-level structure or coefficients change.
+	  - Coarse-level matrix reuse: optional. With "reuseCoarseLevels N" the
+		coarse matrices of a field are kept between solutions and reused
+		for up to N solutions, or until the average convergence rate
+		exceeds "reuseRateFactor" (default 1.5) times that obtained with
+		freshly agglomerated matrices. The agglomeration is only rebuilt
+		when the mesh changes.
+	  - Chebyshev smoother eigenvalues: the estimated largest eigenvalue of
+		each level is cached and only estimated again when the
+		coefficients of the level change, or with "eigenvalueInterval N"
+		every N solutions.
 
 SourceFiles
 	GAMGSolver.C
 	GAMGSolverAgglomerateMatrix.C
+	GAMGSolverCoarseLevels.C
 	GAMGSolverInterpolate.C
 	GAMGSolverScale.C
 	GAMGSolverSolve.C
@@ -59,6 +78,7 @@ SourceFiles
 #include <labelField.hxx>
 #include <primitiveFields.hxx>
 #include <LUscalarMatrix.hxx>
+#include <LDLTscalarMatrix.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -110,6 +130,33 @@ namespace tnbLib
 		//- Direct or iteratively solve the coarsest level
 		bool directSolveCoarsest_;
 
+		//- Solve the coarsest level of symmetric matrices with the sparse
+		//  LDL^T factorisation
+		bool sparseDirectSolveCoarsest_;
+
+		//- Number of solutions for which the coarse levels are reused
+		//  before they are agglomerated again.
+		//  By default the coarse levels are agglomerated for every solution.
+		label reuseCoarseLevels_;
+
+		//- Factor by which the average convergence rate may degrade
+		//  relative to that of the freshly agglomerated coarse levels
+		//  before they are agglomerated again
+		scalar reuseRateFactor_;
+
+		//- Smoother of the coarse levels from coarseSmootherLevel_.
+		//  By default all levels use the smoother of the solver controls.
+		word coarseSmoother_;
+
+		//- First level smoothed by the coarse smoother, the finest level
+		//  being level 0
+		label coarseSmootherLevel_;
+
+		//- Number of solutions for which the estimated largest eigenvalues
+		//  of the Chebyshev smoothers are used although the coefficients
+		//  changed. By default they are estimated for every solution.
+		label eigenvalueInterval_;
+
 		//- The agglomeration
 		const GAMGAgglomeration& agglomeration_;
 
@@ -131,6 +178,22 @@ namespace tnbLib
 		//- LU decompsed coarsest matrix
 		autoPtr<LUscalarMatrix> coarsestLUMatrixPtr_;
 
+		//- LDL^T factorised coarsest matrix, cached in GAMGCoarseLevels
+		const LDLTscalarMatrix* coarsestLDLTMatrixPtr_;
+
+		//- Number of times the coarse levels have been reused
+		label nReuses_;
+
+		//- Average convergence rate obtained with the fresh coarse levels
+		scalar referenceRate_;
+
+		//- Average convergence rate of the last solution
+		mutable scalar rate_;
+
+		//- Estimated largest eigenvalues of the Chebyshev smoothers of the
+		//  levels, the finest level being level 0, -1 if not estimated
+		mutable scalarList smootherLambdaMax_;
+
 
 		// Private Member Functions
 
@@ -158,6 +221,30 @@ namespace tnbLib
 			const label i
 		) const;
 
+		//- Agglomerate the coarse matrices of all levels
+		FoamBase_EXPORT void agglomerateMatrices();
+
+		//- Retrieve the coarse levels cached by a previous solver of the
+		//  same field if they may be reused. Returns true if retrieved.
+		FoamBase_EXPORT bool retrieveCoarseLevels();
+
+		//- Transfer the coarse levels to the cache for reuse
+		FoamBase_EXPORT void storeCoarseLevels();
+
+		//- Retrieve the estimated largest eigenvalues of the smoothers
+		//  cached by a previous solver of the same field which may be used
+		FoamBase_EXPORT void retrieveSmootherEigenvalues
+		(
+			const bool coarseLevelsReused
+		);
+
+		//- Store the estimated largest eigenvalues of the smoothers
+		FoamBase_EXPORT void storeSmootherEigenvalues() const;
+
+		//- Factorise the coarsest level with the cached sparse LDL^T
+		//  factorisation of the field
+		FoamBase_EXPORT void factoriseCoarsestLevel();
+
 		//- Agglomerate coarse matrix. Supply mesh to use - so we can
 		//  construct temporary matrix on the fine mesh (instead of the coarse
 		//  mesh)
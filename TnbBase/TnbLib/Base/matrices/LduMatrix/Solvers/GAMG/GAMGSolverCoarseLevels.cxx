@@ -0,0 +1,150 @@
+#include <GAMGSolver.hxx>
+
+#include <GAMGCoarseLevels.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+bool tnbLib::GAMGSolver::retrieveCoarseLevels()
+{
+	// The cached levels refer to the meshes of the cached agglomeration
+	if (!reuseCoarseLevels_ || !cacheAgglomeration_)
+	{
+		return false;
+	}
+
+	autoPtr<GAMGCoarseLevels::fieldLevels> levels
+	(
+		GAMGCoarseLevels::retrieve
+		(
+			matrix_.mesh(),
+			fieldName_,
+			agglomeration_,
+			matrix_.symmetric(),
+			reuseCoarseLevels_,
+			reuseRateFactor_
+		)
+	);
+
+	if (!levels.valid())
+	{
+		return false;
+	}
+
+	matrixLevels_.transfer(levels->matrixLevels);
+	primitiveInterfaceLevels_.transfer(levels->primitiveInterfaceLevels);
+	interfaceLevels_.transfer(levels->interfaceLevels);
+	interfaceLevelsBouCoeffs_.transfer(levels->interfaceLevelsBouCoeffs);
+	interfaceLevelsIntCoeffs_.transfer(levels->interfaceLevelsIntCoeffs);
+	coarsestLUMatrixPtr_.reset(levels->coarsestLUMatrixPtr.ptr());
+
+	nReuses_ = levels->nReuses;
+	referenceRate_ = levels->referenceRate;
+
+	return true;
+}
+
+
+void tnbLib::GAMGSolver::storeCoarseLevels()
+{
+	if (!reuseCoarseLevels_ || !cacheAgglomeration_ || !matrixLevels_.size())
+	{
+		return;
+	}
+
+	autoPtr<GAMGCoarseLevels::fieldLevels> levels
+	(
+		new GAMGCoarseLevels::fieldLevels()
+	);
+
+	levels->agglomerationPtr = &agglomeration_;
+	levels->symmetric = matrix_.symmetric();
+	levels->nReuses = nReuses_;
+	levels->referenceRate = referenceRate_ > 0 ? referenceRate_ : rate_;
+	levels->rate = rate_;
+
+	levels->matrixLevels.transfer(matrixLevels_);
+	levels->primitiveInterfaceLevels.transfer(primitiveInterfaceLevels_);
+	levels->interfaceLevels.transfer(interfaceLevels_);
+	levels->interfaceLevelsBouCoeffs.transfer(interfaceLevelsBouCoeffs_);
+	levels->interfaceLevelsIntCoeffs.transfer(interfaceLevelsIntCoeffs_);
+	levels->coarsestLUMatrixPtr.reset(coarsestLUMatrixPtr_.ptr());
+
+	GAMGCoarseLevels::insert(matrix_.mesh(), fieldName_, levels);
+}
+
+
+void tnbLib::GAMGSolver::retrieveSmootherEigenvalues
+(
+	const bool coarseLevelsReused
+)
+{
+	if (!cacheAgglomeration_)
+	{
+		return;
+	}
+
+	GAMGCoarseLevels::fieldEigenvalues& cached =
+		GAMGCoarseLevels::eigenvalues(matrix_.mesh(), fieldName_);
+
+	if (cached.lambdaMax.size() != smootherLambdaMax_.size())
+	{
+		cached.nSolutions = 0;
+		cached.lambdaMax = scalarList(smootherLambdaMax_.size(), -1.0);
+	}
+
+	// All estimates are used for eigenvalueInterval_ solutions, those of
+	// the coarse levels also while their coefficients are unchanged
+	if (cached.nSolutions > 0 && cached.nSolutions < eigenvalueInterval_)
+	{
+		smootherLambdaMax_ = cached.lambdaMax;
+		cached.nSolutions++;
+	}
+	else
+	{
+		if (coarseLevelsReused)
+		{
+			for (label i = 1; i < smootherLambdaMax_.size(); i++)
+			{
+				smootherLambdaMax_[i] = cached.lambdaMax[i];
+			}
+		}
+
+		cached.nSolutions = 1;
+	}
+}
+
+
+void tnbLib::GAMGSolver::storeSmootherEigenvalues() const
+{
+	if (!cacheAgglomeration_)
+	{
+		return;
+	}
+
+	GAMGCoarseLevels::eigenvalues(matrix_.mesh(), fieldName_).lambdaMax =
+		smootherLambdaMax_;
+}
+
+
+void tnbLib::GAMGSolver::factoriseCoarsestLevel()
+{
+	const label coarsestLevel = matrixLevels_.size() - 1;
+
+	if (matrixLevels_.set(coarsestLevel))
+	{
+		LDLTscalarMatrix& coarsestLDLTMatrix =
+			GAMGCoarseLevels::coarsestMatrix(matrix_.mesh(), fieldName_);
+
+		coarsestLDLTMatrix.factorise
+		(
+			matrixLevels_[coarsestLevel],
+			interfaceLevelsBouCoeffs_[coarsestLevel],
+			interfaceLevels_[coarsestLevel]
+		);
+
+		coarsestLDLTMatrixPtr_ = &coarsestLDLTMatrix;
+	}
+}
+
+
+// ************************************************************************* //
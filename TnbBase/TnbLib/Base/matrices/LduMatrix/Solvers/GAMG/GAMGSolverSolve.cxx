@@ -2,6 +2,7 @@
 
 #include <PCG.hxx>
 #include <PBiCGStab.hxx>
+#include <ChebyshevSmoother.hxx>
 #include <SubField.hxx>
 
 #include <IOstreams.hxx> // added by amir
@@ -27,25 +28,28 @@ tnbLib::solverPerformance tnbLib::GAMGSolver::solve
 	// temporary in normFactor
 	scalarField finestCorrection(psi.size());
 
-	// Calculate normalisation factor
-	scalar normFactor = this->normFactor(psi, source, Apsi, finestCorrection);
-
-	if (debug >= 2)
-	{
-		Pout << "   Normalisation factor = " << normFactor << endl;
-	}
-
 	// Calculate initial finest-grid residual field
 	scalarField finestResidual(source - Apsi);
 
-	// Calculate normalised residual for convergence test
-	solverPerf.initialResidual() = gSumMag
+	// Calculate normalisation factor and normalised residual for
+	// convergence test
+	scalar normFactor = 0;
+	solverPerf.initialResidual() = this->normalisedResidual
 	(
+		psi,
+		source,
+		Apsi,
 		finestResidual,
-		matrix().mesh().comm()
-	) / normFactor;
+		finestCorrection,
+		normFactor
+	);
 	solverPerf.finalResidual() = solverPerf.initialResidual();
 
+	if (debug >= 2)
+	{
+		Pout << "   Normalisation factor = " << normFactor << endl;
+	}
+
 
 	// Check convergence, solve if not converged
 	if
@@ -120,6 +124,17 @@ tnbLib::solverPerformance tnbLib::GAMGSolver::solve
 				)
 				|| solverPerf.nIterations() < minIter_
 				);
+
+		// Average convergence rate, used to control the reuse of the
+		// coarse levels
+		if (solverPerf.initialResidual() > small)
+		{
+			rate_ = pow
+			(
+				solverPerf.finalResidual()/solverPerf.initialResidual(),
+				1.0/solverPerf.nIterations()
+			);
+		}
 	}
 
 	return solverPerf;
@@ -439,6 +454,44 @@ void tnbLib::GAMGSolver::initVcycle
 	coarseSources.setSize(matrixLevels_.size());
 	smoothers.setSize(matrixLevels_.size() + 1);
 
+	// Solver controls with the smoother replaced by the coarse smoother
+	dictionary coarseSmootherControls;
+
+	if (coarseSmoother_.size())
+	{
+		coarseSmootherControls = controlDict_;
+		coarseSmootherControls.set("smoother", coarseSmoother_);
+	}
+
+	// Return the controls selecting the smoother of the given level
+	auto smootherControls = [&](const label leveli) -> const dictionary&
+	{
+		return
+			coarseSmoother_.size() && leveli >= coarseSmootherLevel_
+		  ? coarseSmootherControls
+		  : controlDict_;
+	};
+
+	// Set the cached largest eigenvalue of a Chebyshev smoother of the
+	// given level, or cache its estimate
+	auto cacheEigenvalue = [&](const label i)
+	{
+		if (isA<ChebyshevSmoother>(smoothers[i]))
+		{
+			ChebyshevSmoother& smoother =
+				refCast<ChebyshevSmoother>(smoothers[i]);
+
+			if (smootherLambdaMax_[i] > 0)
+			{
+				smoother.lambdaMax(smootherLambdaMax_[i]);
+			}
+			else
+			{
+				smootherLambdaMax_[i] = smoother.lambdaMax();
+			}
+		}
+	};
+
 	// Create the smoother for the finest level
 	smoothers.set
 	(
@@ -450,9 +503,10 @@ void tnbLib::GAMGSolver::initVcycle
 			interfaceBouCoeffs_,
 			interfaceIntCoeffs_,
 			interfaces_,
-			controlDict_
+			smootherControls(0)
 		)
 	);
+	cacheEigenvalue(0);
 
 	forAll(matrixLevels_, leveli)
 	{
@@ -483,9 +537,10 @@ void tnbLib::GAMGSolver::initVcycle
 					interfaceLevelsBouCoeffs_[leveli],
 					interfaceLevelsIntCoeffs_[leveli],
 					interfaceLevels_[leveli],
-					controlDict_
+					smootherControls(leveli + 1)
 				)
 			);
+			cacheEigenvalue(leveli + 1);
 		}
 	}
 
@@ -536,7 +591,11 @@ void tnbLib::GAMGSolver::solveCoarsestLevel
 
 	label coarseComm = matrixLevels_[coarsestLevel].mesh().comm();
 
-	if (directSolveCoarsest_)
+	if (sparseDirectSolveCoarsest_)
+	{
+		coarsestLDLTMatrixPtr_->solve(coarsestCorrField, coarsestSource);
+	}
+	else if (directSolveCoarsest_)
 	{
 		coarsestLUMatrixPtr_->solve(coarsestCorrField, coarsestSource);
 	}
@@ -37,7 +37,9 @@ tnbLib::processorGAMGInterfaceField::processorGAMGInterfaceField
 	GAMGInterfaceField(GAMGCp, fineInterface),
 	procInterface_(refCast<const processorGAMGInterface>(GAMGCp)),
 	doTransform_(false),
-	rank_(0)
+	rank_(0),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {
 	const processorLduInterfaceField& p =
 		refCast<const processorLduInterfaceField>(fineInterface);
@@ -57,14 +59,19 @@ tnbLib::processorGAMGInterfaceField::processorGAMGInterfaceField
 	GAMGInterfaceField(GAMGCp, doTransform, rank),
 	procInterface_(refCast<const processorGAMGInterface>(GAMGCp)),
 	doTransform_(doTransform),
-	rank_(rank)
+	rank_(rank),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {}
 
 
 // * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
 
 tnbLib::processorGAMGInterfaceField::~processorGAMGInterfaceField()
-{}
+{
+	UPstream::freeChannel(scalarSendChannel_);
+	UPstream::freeChannel(scalarReceiveChannel_);
+}
 
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
@@ -84,6 +91,7 @@ void tnbLib::processorGAMGInterfaceField::initInterfaceMatrixUpdate
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procInterface_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -91,7 +99,7 @@ void tnbLib::processorGAMGInterfaceField::initInterfaceMatrixUpdate
 		outstandingRecvRequest_ = UPstream::nRequests();
 		IPstream::read
 		(
-			Pstream::commsTypes::nonBlocking,
+			scalarReceiveChannel_,
 			procInterface_.neighbProcNo(),
 			reinterpret_cast<char*>(scalarReceiveBuf_.begin()),
 			scalarReceiveBuf_.byteSize(),
@@ -102,7 +110,7 @@ void tnbLib::processorGAMGInterfaceField::initInterfaceMatrixUpdate
 		outstandingSendRequest_ = UPstream::nRequests();
 		OPstream::write
 		(
-			Pstream::commsTypes::nonBlocking,
+			scalarSendChannel_,
 			procInterface_.neighbProcNo(),
 			reinterpret_cast<const char*>(scalarSendBuf_.begin()),
 			scalarSendBuf_.byteSize(),
@@ -139,6 +147,7 @@ void tnbLib::processorGAMGInterfaceField::updateInterfaceMatrix
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procInterface_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -0,0 +1,216 @@
+#pragma once
+#ifndef _MultiComponentSolverTemplate_Header
+#define _MultiComponentSolverTemplate_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::MultiComponentSolver
+
+Description
+	Preconditioned bi-conjugate gradient stabilised solver solving all the
+	components of a vector or tensor field in a single pass over the matrix
+	coefficients.
+
+	The components of a segregated fvMatrix share the off-diagonal
+	coefficients and the addressing and only differ in the diagonal, the
+	source and the boundary coefficients.  Here the solution is held
+	interleaved as a Field<Type> and the PBiCGStab iterations of the
+	components are run in lock-step, so that Amul and the preconditioner
+	read the shared coefficients once per iteration for all components and
+	the reductions of all components are combined into one.  The diagonal
+	is held per component so the result is that of the segregated solution.
+
+	Each component checks for convergence and singularity independently
+	and is frozen once it has converged.  Coupled interfaces are updated
+	component by component.
+
+	Supported preconditioners are DILU, DIC (applied as DILU to the shared
+	symmetric coefficients), diagonal and none.
+
+	Selected in fvSolution by
+	\verbatim
+		U
+		{
+			type            multiComponent;
+			solver          PBiCGStab;
+			preconditioner  DILU;
+			tolerance       1e-6;
+			relTol          0.1;
+		}
+	\endverbatim
+
+SourceFiles
+	MultiComponentSolverTemplateI.hxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <lduMatrix.hxx>
+#include <PtrList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+						  Class MultiComponentSolver Declaration
+	\*---------------------------------------------------------------------------*/
+
+	template<class Type>
+	class MultiComponentSolver
+	{
+		// Private Data
+
+			//- Name of the solved field
+		word fieldName_;
+
+		//- Matrix providing the shared off-diagonal coefficients
+		//  and the addressing
+		const lduMatrix& matrix_;
+
+		//- Diagonal coefficients of all the components
+		const Field<Type>& diag_;
+
+		//- Interface boundary coefficients of each component
+		const PtrList<FieldField<Field, scalar>>& interfaceBouCoeffs_;
+
+		//- Coupled interfaces
+		const lduInterfaceFieldPtrsList& interfaces_;
+
+		//- Components to solve for (-1 for the components not solved)
+		typename pTraits<Type>::labelType validComponents_;
+
+		//- Dictionary of controls
+		dictionary controlDict_;
+
+		//- Maximum number of iterations in the solver
+		label maxIter_;
+
+		//- Minimum number of iterations in the solver
+		label minIter_;
+
+		//- Final convergence tolerance
+		scalar tolerance_;
+
+		//- Convergence tolerance relative to the initial
+		scalar relTol_;
+
+		//- Name of the preconditioner
+		word preconditionerName_;
+
+		//- The reciprocal preconditioned diagonal
+		Field<Type> rD_;
+
+		//- Cells adjacent to the coupled interfaces
+		labelList interfaceCells_;
+
+		//- Component work fields for the interface updates
+		mutable scalarField psiCmpt_;
+		mutable scalarField resultCmpt_;
+
+
+		// Private Member Functions
+
+			//- Read the control parameters from the controlDict_
+		void readControls();
+
+		//- Calculate the reciprocal of the preconditioned diagonal
+		void calcReciprocalD();
+
+		//- Collect the cells adjacent to the coupled interfaces
+		void calcInterfaceCells();
+
+		//- Matrix multiplication of all the components
+		void Amul(Field<Type>& Apsi, const Field<Type>& psi) const;
+
+		//- Sum the coefficients on each row of the matrix
+		void sumA(Field<Type>& sumA) const;
+
+		//- Return the matrix norm used to normalise the residual of each
+		//  component for the stopping criterion
+		Type normFactor
+		(
+			const Field<Type>& psi,
+			const Field<Type>& source,
+			const Field<Type>& Apsi,
+			Field<Type>& tmpField
+		) const;
+
+		//- Return wA the preconditioned form of residual rA
+		void precondition(Field<Type>& wA, const Field<Type>& rA) const;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from the shared matrix, the diagonal of all the
+			//  components, the boundary coefficients of each component,
+			//  the interfaces and the solver controls
+		MultiComponentSolver
+		(
+			const word& fieldName,
+			const lduMatrix& matrix,
+			const Field<Type>& diag,
+			const PtrList<FieldField<Field, scalar>>& interfaceBouCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			const typename pTraits<Type>::labelType& validComponents,
+			const dictionary& solverControls
+		);
+
+		//- Disallow default bitwise copy construction
+		MultiComponentSolver(const MultiComponentSolver&) = delete;
+
+
+		// Member Functions
+
+			//- Solve for all the components of psi returning the solution
+			//  statistics of each component
+		List<solverPerformance> solve
+		(
+			Field<Type>& psi,
+			const Field<Type>& source
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const MultiComponentSolver&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <MultiComponentSolverTemplateI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_MultiComponentSolverTemplate_Header
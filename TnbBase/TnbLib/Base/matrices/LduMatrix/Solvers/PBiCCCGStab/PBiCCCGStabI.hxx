@@ -0,0 +1,220 @@
+#pragma once
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class Type, class DType, class LUType>
+tnbLib::PBiCCCGStab<Type, DType, LUType>::PBiCCCGStab
+(
+	const word& fieldName,
+	const LduMatrix<Type, DType, LUType>& matrix,
+	const dictionary& solverDict
+)
+	:
+	LduMatrix<Type, DType, LUType>::solver
+	(
+		fieldName,
+		matrix,
+		solverDict
+	)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type, class DType, class LUType>
+tnbLib::SolverPerformance<Type>
+tnbLib::PBiCCCGStab<Type, DType, LUType>::solve
+(
+	Field<Type>& psi
+) const
+{
+	word preconditionerName(this->controlDict_.lookup("preconditioner"));
+
+	// --- Setup class containing solver performance data
+	SolverPerformance<Type> solverPerf
+	(
+		preconditionerName + typeName,
+		this->fieldName_
+	);
+
+	label nIter = 0;
+
+	label nCells = psi.size();
+
+	Type* __restrict psiPtr = psi.begin();
+
+	Field<Type> pA(nCells);
+	Type* __restrict pAPtr = pA.begin();
+
+	Field<Type> yA(nCells);
+	Type* __restrict yAPtr = yA.begin();
+
+	// --- Calculate A.psi
+	this->matrix_.Amul(yA, psi);
+
+	// --- Calculate initial residual field
+	Field<Type> rA(this->matrix_.source() - yA);
+	Type* __restrict rAPtr = rA.begin();
+
+	// --- Calculate normalisation factor
+	Type normFactor = this->normFactor(psi, yA, pA);
+
+	if (LduMatrix<Type, DType, LUType>::debug >= 2)
+	{
+		Info << "   Normalisation factor = " << normFactor << endl;
+	}
+
+	// --- Calculate normalised residual norm
+	solverPerf.initialResidual() = cmptDivide(gSumCmptMag(rA), normFactor);
+	solverPerf.finalResidual() = solverPerf.initialResidual();
+
+	// --- Check convergence, solve if not converged
+	if
+		(
+			this->minIter_ > 0
+			|| !solverPerf.checkConvergence(this->tolerance_, this->relTol_)
+			)
+	{
+		Field<Type> AyA(nCells);
+		Type* __restrict AyAPtr = AyA.begin();
+
+		Field<Type> sA(nCells);
+		Type* __restrict sAPtr = sA.begin();
+
+		Field<Type> zA(nCells);
+		Type* __restrict zAPtr = zA.begin();
+
+		Field<Type> tA(nCells);
+		Type* __restrict tAPtr = tA.begin();
+
+		// --- Store initial residual
+		const Field<Type> rA0(rA);
+
+		// --- Initial values not used
+		scalar rA0rA = 0;
+		scalar alpha = 0;
+		scalar omega = 0;
+
+		// --- Select and construct the preconditioner
+		autoPtr<typename LduMatrix<Type, DType, LUType>::preconditioner>
+			preconPtr = LduMatrix<Type, DType, LUType>::preconditioner::New
+			(
+				*this,
+				this->controlDict_
+			);
+
+		// --- Solver iteration
+		do
+		{
+			// --- Store previous rA0rA
+			const scalar rA0rAold = rA0rA;
+
+			rA0rA = gSumProd(rA0, rA);
+
+			// --- Test for singularity
+			if
+				(
+					solverPerf.checkSingularity
+					(
+						cmptDivide(pTraits<Type>::one*mag(rA0rA), normFactor)
+					)
+					)
+			{
+				break;
+			}
+
+			// --- Update pA
+			if (nIter == 0)
+			{
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					pAPtr[cell] = rAPtr[cell];
+				}
+			}
+			else
+			{
+				// --- Test for singularity
+				if (solverPerf.checkSingularity(pTraits<Type>::one*mag(omega)))
+				{
+					break;
+				}
+
+				const scalar beta = (rA0rA / rA0rAold)*(alpha / omega);
+
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					pAPtr[cell] =
+						rAPtr[cell] + beta * (pAPtr[cell] - omega * AyAPtr[cell]);
+				}
+			}
+
+			// --- Precondition pA
+			preconPtr->precondition(yA, pA);
+
+			// --- Calculate AyA
+			this->matrix_.Amul(AyA, yA);
+
+			const scalar rA0AyA = gSumProd(rA0, AyA);
+
+			alpha = rA0rA / rA0AyA;
+
+			// --- Calculate sA
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				sAPtr[cell] = rAPtr[cell] - alpha * AyAPtr[cell];
+			}
+
+			// --- Test sA for convergence
+			solverPerf.finalResidual() =
+				cmptDivide(gSumCmptMag(sA), normFactor);
+
+			if (solverPerf.checkConvergence(this->tolerance_, this->relTol_))
+			{
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					psiPtr[cell] += alpha * yAPtr[cell];
+				}
+
+				nIter++;
+
+				break;
+			}
+
+			// --- Precondition sA
+			preconPtr->precondition(zA, sA);
+
+			// --- Calculate tA
+			this->matrix_.Amul(tA, zA);
+
+			const scalar tAtA = gSumProd(tA, tA);
+
+			// --- Calculate omega from tA and sA
+			//     (cheaper than using zA with preconditioned tA)
+			omega = gSumProd(tA, sA) / tAtA;
+
+			// --- Update solution and residual
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				psiPtr[cell] += alpha * yAPtr[cell] + omega * zAPtr[cell];
+				rAPtr[cell] = sAPtr[cell] - omega * tAPtr[cell];
+			}
+
+			solverPerf.finalResidual() =
+				cmptDivide(gSumCmptMag(rA), normFactor);
+		} while
+			(
+			(
+				++nIter < this->maxIter_
+				&& !solverPerf.checkConvergence(this->tolerance_, this->relTol_)
+				)
+				|| nIter < this->minIter_
+				);
+	}
+
+	solverPerf.nIterations() =
+		pTraits<typename pTraits<Type>::labelType>::one*nIter;
+
+	return solverPerf;
+}
+
+
+// ************************************************************************* //
@@ -71,20 +71,17 @@ tnbLib::solverPerformance tnbLib::PBiCGStab::solve
 	scalarField rA(source - yA);
 	scalar* __restrict rAPtr = rA.begin();
 
-	// --- Calculate normalisation factor
-	const scalar normFactor = this->normFactor(psi, source, yA, pA);
+	// --- Calculate normalisation factor and normalised residual norm
+	scalar normFactor = 0;
+	solverPerf.initialResidual() =
+		this->normalisedResidual(psi, source, yA, rA, pA, normFactor);
+	solverPerf.finalResidual() = solverPerf.initialResidual();
 
 	if (lduMatrix::debug >= 2)
 	{
 		Info << "   Normalisation factor = " << normFactor << endl;
 	}
 
-	// --- Calculate normalised residual norm
-	solverPerf.initialResidual() =
-		gSumMag(rA, matrix().mesh().comm())
-		/ normFactor;
-	solverPerf.finalResidual() = solverPerf.initialResidual();
-
 	// --- Check convergence, solve if not converged
 	if
 		(
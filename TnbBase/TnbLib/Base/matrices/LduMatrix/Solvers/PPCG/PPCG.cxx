@@ -0,0 +1,277 @@
+#include <PPCG.hxx>
+
+#include <PstreamReduceOps.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(PPCG, 0);
+
+	lduMatrix::solver::addsymMatrixConstructorToTable<PPCG>
+		addPPCGSymMatrixConstructorToTable_;
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::PPCG::gSumMagProd
+(
+	FixedList<scalar, 3>& globalSum,
+	const scalarField& a,
+	const scalarField& b,
+	const scalarField& c,
+	const scalarField& d,
+	label& requestID
+) const
+{
+	const scalar* const __restrict aPtr = a.begin();
+	const scalar* const __restrict bPtr = b.begin();
+	const scalar* const __restrict cPtr = c.begin();
+	const scalar* const __restrict dPtr = d.begin();
+
+	const label nCells = a.size();
+
+	scalar sumProdAB = 0;
+	scalar sumProdAC = 0;
+	scalar sumMagD = 0;
+
+	for (label cell = 0; cell < nCells; cell++)
+	{
+		sumProdAB += aPtr[cell] * bPtr[cell];
+		sumProdAC += aPtr[cell] * cPtr[cell];
+		sumMagD += mag(dPtr[cell]);
+	}
+
+	globalSum[0] = sumProdAB;
+	globalSum[1] = sumProdAC;
+	globalSum[2] = sumMagD;
+
+	requestID = -1;
+
+	if (Pstream::parRun())
+	{
+		reduce
+		(
+			globalSum.begin(),
+			globalSum.size(),
+			sumOp<scalar>(),
+			Pstream::msgType(),
+			matrix().mesh().comm(),
+			requestID
+		);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::PPCG::PPCG
+(
+	const word& fieldName,
+	const lduMatrix& matrix,
+	const FieldField<Field, scalar>& interfaceBouCoeffs,
+	const FieldField<Field, scalar>& interfaceIntCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	const dictionary& solverControls
+)
+	:
+	lduMatrix::solver
+	(
+		fieldName,
+		matrix,
+		interfaceBouCoeffs,
+		interfaceIntCoeffs,
+		interfaces,
+		solverControls
+	)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+tnbLib::solverPerformance tnbLib::PPCG::solve
+(
+	scalarField& psi,
+	const scalarField& source,
+	const direction cmpt
+) const
+{
+	// --- Setup class containing solver performance data
+	solverPerformance solverPerf
+	(
+		lduMatrix::preconditioner::getName(controlDict_) + typeName,
+		fieldName_
+	);
+
+	label nCells = psi.size();
+
+	scalar* __restrict psiPtr = psi.begin();
+
+	scalarField wA(nCells);
+	scalar* __restrict wAPtr = wA.begin();
+
+	// --- Calculate A.psi
+	matrix_.Amul(wA, psi, interfaceBouCoeffs_, interfaces_, cmpt);
+
+	// --- Calculate initial residual field
+	scalarField rA(source - wA);
+	scalar* __restrict rAPtr = rA.begin();
+
+	// --- Calculate normalisation factor
+	scalarField uA(nCells);
+	scalar* __restrict uAPtr = uA.begin();
+
+	scalar normFactor = this->normFactor(psi, source, wA, uA);
+
+	if (lduMatrix::debug >= 2)
+	{
+		Info << "   Normalisation factor = " << normFactor << endl;
+	}
+
+	// --- Select and construct the preconditioner
+	autoPtr<lduMatrix::preconditioner> preconPtr =
+		lduMatrix::preconditioner::New
+		(
+			*this,
+			controlDict_
+		);
+
+	// --- Precondition residual
+	preconPtr->precondition(uA, rA, cmpt);
+
+	// --- Calculate A.u
+	matrix_.Amul(wA, uA, interfaceBouCoeffs_, interfaces_, cmpt);
+
+	// --- Start the reduction of (u, r), (u, w) and the residual norm.
+	//  Its request is completed with waitRequests from the first request
+	//  it posted so that the list of outstanding requests does not grow
+	FixedList<scalar, 3> globalSum;
+	label requestID = -1;
+	label startOfRequests = UPstream::nRequests();
+	gSumMagProd(globalSum, uA, rA, wA, rA, requestID);
+
+	// --- Precondition w and calculate A.m while the reduction is in flight
+	scalarField mA(nCells);
+	scalar* __restrict mAPtr = mA.begin();
+
+	scalarField nA(nCells);
+	scalar* __restrict nAPtr = nA.begin();
+
+	preconPtr->precondition(mA, wA, cmpt);
+	matrix_.Amul(nA, mA, interfaceBouCoeffs_, interfaces_, cmpt);
+
+	// --- Search direction p and its recurrences s = A.p, q = M.s, z = A.q
+	scalarField pA(nCells);
+	scalar* __restrict pAPtr = pA.begin();
+
+	scalarField sA(nCells);
+	scalar* __restrict sAPtr = sA.begin();
+
+	scalarField qA(nCells);
+	scalar* __restrict qAPtr = qA.begin();
+
+	scalarField zA(nCells);
+	scalar* __restrict zAPtr = zA.begin();
+
+	scalar alpha = 0;
+	scalar gamma = 0;
+
+	// --- Solver iteration
+	while (true)
+	{
+		// --- Complete the reduction
+		if (requestID != -1)
+		{
+			if (startOfRequests < UPstream::nRequests())
+			{
+				UPstream::waitRequests(startOfRequests);
+			}
+			requestID = -1;
+		}
+
+		const scalar gammaOld = gamma;
+		gamma = globalSum[0];
+		const scalar delta = globalSum[1];
+
+		// --- Calculate normalised residual norm
+		solverPerf.finalResidual() = globalSum[2] / normFactor;
+
+		if (solverPerf.nIterations() == 0)
+		{
+			solverPerf.initialResidual() = solverPerf.finalResidual();
+		}
+
+		// --- Check convergence
+		const bool converged =
+			solverPerf.checkConvergence(tolerance_, relTol_);
+
+		if
+			(
+				solverPerf.nIterations() >= minIter_
+				&& (converged || solverPerf.nIterations() >= maxIter_)
+				)
+		{
+			break;
+		}
+
+		// --- Update search directions:
+		if (solverPerf.nIterations() == 0)
+		{
+			// --- Test for singularity
+			if (solverPerf.checkSingularity(mag(delta) / normFactor)) break;
+
+			alpha = gamma / delta;
+
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				zAPtr[cell] = nAPtr[cell];
+				qAPtr[cell] = mAPtr[cell];
+				sAPtr[cell] = wAPtr[cell];
+				pAPtr[cell] = uAPtr[cell];
+			}
+		}
+		else
+		{
+			const scalar beta = gamma / gammaOld;
+			const scalar denom = delta - beta * gamma / alpha;
+
+			// --- Test for singularity
+			if (solverPerf.checkSingularity(mag(denom) / normFactor)) break;
+
+			alpha = gamma / denom;
+
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				zAPtr[cell] = nAPtr[cell] + beta * zAPtr[cell];
+				qAPtr[cell] = mAPtr[cell] + beta * qAPtr[cell];
+				sAPtr[cell] = wAPtr[cell] + beta * sAPtr[cell];
+				pAPtr[cell] = uAPtr[cell] + beta * pAPtr[cell];
+			}
+		}
+
+		// --- Update solution, residual and their preconditioned forms
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			psiPtr[cell] += alpha * pAPtr[cell];
+			rAPtr[cell] -= alpha * sAPtr[cell];
+			uAPtr[cell] -= alpha * qAPtr[cell];
+			wAPtr[cell] -= alpha * zAPtr[cell];
+		}
+
+		solverPerf.nIterations()++;
+
+		// --- Start the reduction for the next iteration
+		startOfRequests = UPstream::nRequests();
+		gSumMagProd(globalSum, uA, rA, wA, rA, requestID);
+
+		// --- Precondition w and calculate A.m while the reduction is in flight
+		preconPtr->precondition(mA, wA, cmpt);
+		matrix_.Amul(nA, mA, interfaceBouCoeffs_, interfaces_, cmpt);
+	}
+
+	return solverPerf;
+}
+
+
+// ************************************************************************* //
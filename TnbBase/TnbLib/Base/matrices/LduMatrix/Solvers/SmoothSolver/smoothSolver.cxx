@@ -93,15 +93,16 @@ tnbLib::solverPerformance tnbLib::smoothSolver::solve
 			// Calculate A.psi
 			matrix_.Amul(Apsi, psi, interfaceBouCoeffs_, interfaces_, cmpt);
 
-			// Calculate normalisation factor
-			normFactor = this->normFactor(psi, source, Apsi, temp);
-
-			// Calculate residual magnitude
-			solverPerf.initialResidual() = gSumMag
+			// Calculate normalisation factor and residual magnitude
+			solverPerf.initialResidual() = this->normalisedResidual
 			(
+				psi,
+				source,
+				Apsi,
 				(source - Apsi)(),
-				matrix().mesh().comm()
-			) / normFactor;
+				temp,
+				normFactor
+			);
 			solverPerf.finalResidual() = solverPerf.initialResidual();
 		}
 
@@ -1,6 +1,7 @@
 #include <PCICG.hxx>
 #include <PBiCCCG.hxx>
 #include <PBiCICG.hxx>
+#include <PBiCCCGStab.hxx>
 #include <SmoothSolverTemplate.hxx>
 #include <DiagonalSolverTemplate.hxx>  // added by amir
 #include <fieldTypes.hxx>
@@ -20,6 +21,10 @@
     makeLduSolver(PBiCICG, Type, DType, LUType);                               \
     makeLduAsymSolver(PBiCICG, Type, DType, LUType);                           \
                                                                                \
+    makeLduSolver(PBiCCCGStab, Type, DType, LUType);                           \
+    makeLduSymSolver(PBiCCCGStab, Type, DType, LUType);                        \
+    makeLduAsymSolver(PBiCCCGStab, Type, DType, LUType);                       \
+                                                                               \
     makeLduSolver(SmoothSolver, Type, DType, LUType);                          \
     makeLduSymSolver(SmoothSolver, Type, DType, LUType);                       \
     makeLduAsymSolver(SmoothSolver, Type, DType, LUType);
@@ -2,6 +2,67 @@
 
 #include <demandDrivenData.hxx>
 #include <scalarField.hxx>
+#include <threadPool.hxx>
+#include <firstTouch.hxx>
+#include <lduCSRAddressing.hxx>
+#include <lduLevelSchedule.hxx>
+#include <ListOps.hxx>
+#include <registerSwitch.hxx>
+#include <taskParallel.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+const tnbLib::label tnbLib::lduAddressing::minThreadBlockSize = 1000;
+
+int tnbLib::lduAddressing::cacheBlockSize
+(
+	tnbLib::debug::optimisationSwitch("cacheBlockSize", 0)
+);
+
+registerOptSwitch
+(
+	"cacheBlockSize",
+	int,
+	tnbLib::lduAddressing::cacheBlockSize
+);
+
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	//- Stable counting sort of the given faces on the block of the given
+	//  cell of each face
+	static void sortFacesOnCellBlock
+	(
+		const labelUList& faceCells,
+		const label nCellsPerBlock,
+		const label nBlocks,
+		const labelUList& faces,
+		labelList& sortedFaces
+	)
+	{
+		labelList blockStart(nBlocks + 1, 0);
+
+		forAll(faces, i)
+		{
+			blockStart[faceCells[faces[i]] / nCellsPerBlock + 1]++;
+		}
+
+		for (label blocki = 0; blocki < nBlocks; blocki++)
+		{
+			blockStart[blocki + 1] += blockStart[blocki];
+		}
+
+		forAll(faces, i)
+		{
+			const label facei = faces[i];
+
+			sortedFaces[blockStart[faceCells[facei] / nCellsPerBlock]++] = facei;
+		}
+	}
+}
+
 
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
 
@@ -46,9 +107,9 @@ void tnbLib::lduAddressing::calcLosort() const
 	}
 
 	// Gather the neighbours into the losort array
-	losortPtr_ = new labelList(nbr.size(), -1);
+	labelList* lstPtr = new labelList(nbr.size(), -1);
 
-	labelList& lst = *losortPtr_;
+	labelList& lst = *lstPtr;
 
 	// Set counter for losort
 	label lstI = 0;
@@ -63,6 +124,8 @@ void tnbLib::lduAddressing::calcLosort() const
 			lstI++;
 		}
 	}
+
+	losortPtr_ = lstPtr;
 }
 
 
@@ -77,9 +140,9 @@ void tnbLib::lduAddressing::calcOwnerStart() const
 
 	const labelList& own = lowerAddr();
 
-	ownerStartPtr_ = new labelList(size() + 1, own.size());
+	labelList* ownStartPtr = new labelList(size() + 1, own.size());
 
-	labelList& ownStart = *ownerStartPtr_;
+	labelList& ownStart = *ownStartPtr;
 
 	// Set up first lookup by hand
 	ownStart[0] = 0;
@@ -100,6 +163,8 @@ void tnbLib::lduAddressing::calcOwnerStart() const
 			nOwnStart = curOwn;
 		}
 	}
+
+	ownerStartPtr_ = ownStartPtr;
 }
 
 
@@ -112,9 +177,9 @@ void tnbLib::lduAddressing::calcLosortStart() const
 			<< abort(FatalError);
 	}
 
-	losortStartPtr_ = new labelList(size() + 1, 0);
+	labelList* lsrtStartPtr = new labelList(size() + 1, 0);
 
-	labelList& lsrtStart = *losortStartPtr_;
+	labelList& lsrtStart = *lsrtStartPtr;
 
 	const labelList& nbr = upperAddr();
 
@@ -143,6 +208,209 @@ void tnbLib::lduAddressing::calcLosortStart() const
 
 	// Set up last lookup by hand
 	lsrtStart[size()] = nbr.size();
+
+	losortStartPtr_ = lsrtStartPtr;
+}
+
+
+void tnbLib::lduAddressing::calcThreadBlockStart() const
+{
+	if (threadBlockStartPtr_)
+	{
+		FatalErrorInFunction
+			<< "thread block start already calculated"
+			<< abort(FatalError);
+	}
+
+	threadBlockNThreads_ = max(threadPool::nThreads, 1);
+
+	const label nBlocks =
+		max(min(threadBlockNThreads_, size() / minThreadBlockSize), label(1));
+
+	labelList* blockStartPtr = new labelList(nBlocks + 1, size());
+
+	labelList& blockStart = *blockStartPtr;
+
+	blockStart[0] = 0;
+
+	if (nBlocks > 1 && firstTouch::numaFirstTouch)
+	{
+		// With NUMA first-touch placement the blocks are the equal parts of
+		// the equations placed by the threads
+		for (label blocki = 1; blocki < nBlocks; blocki++)
+		{
+			blockStart[blocki] = label(double(size())*blocki / nBlocks);
+		}
+	}
+	else if (nBlocks > 1)
+	{
+		// Balance the blocks on the number of coefficients in the rows
+		const labelUList& ownStart = ownerStartAddr();
+		const labelUList& lsrtStart = losortStartAddr();
+
+		const scalar nCoeffs = size() + 2.0*lowerAddr().size();
+
+		scalar rowSum = 0;
+		label blocki = 1;
+
+		for (label celli = 0; celli < size() && blocki < nBlocks; celli++)
+		{
+			rowSum +=
+				1
+				+ ownStart[celli + 1] - ownStart[celli]
+				+ lsrtStart[celli + 1] - lsrtStart[celli];
+
+			if (rowSum >= blocki*nCoeffs/nBlocks)
+			{
+				blockStart[blocki++] = celli + 1;
+			}
+		}
+	}
+
+	threadBlockStartPtr_ = blockStartPtr;
+}
+
+
+void tnbLib::lduAddressing::calcCSRAddr() const
+{
+	if (csrAddrPtr_)
+	{
+		FatalErrorInFunction
+			<< "CSR addressing already calculated"
+			<< abort(FatalError);
+	}
+
+	csrAddrPtr_ = new lduCSRAddressing(*this);
+}
+
+
+void tnbLib::lduAddressing::calcLevelSchedule() const
+{
+	if (levelSchedulePtr_)
+	{
+		FatalErrorInFunction
+			<< "Level schedule already calculated"
+			<< abort(FatalError);
+	}
+
+	levelSchedulePtr_ = new lduLevelSchedule(*this);
+}
+
+
+void tnbLib::lduAddressing::calcInteriorBoundarySplit
+(
+	const boolUList& patches
+) const
+{
+	if (boundaryCellsPtr_)
+	{
+		if (splitPatches_ == patches)
+		{
+			return;
+		}
+
+		deleteDemandDrivenData(boundaryCellsPtr_);
+		deleteDemandDrivenData(boundaryFacesPtr_);
+	}
+
+	// Mark the cells adjacent to the selected patches
+	boolList isBoundaryCell(size(), false);
+
+	forAll(patches, patchi)
+	{
+		if (patches[patchi])
+		{
+			const labelUList& pa = patchAddr(patchi);
+
+			forAll(pa, facei)
+			{
+				isBoundaryCell[pa[facei]] = true;
+			}
+		}
+	}
+
+	labelList* boundaryCellsPtr =
+		new labelList(findIndices(isBoundaryCell, true));
+
+	// Collect the faces contributing to the boundary rows
+	const labelUList& l = lowerAddr();
+	const labelUList& u = upperAddr();
+
+	labelList* boundaryFacesPtr = new labelList(l.size());
+	labelList& boundaryFaces = *boundaryFacesPtr;
+
+	label nBoundaryFaces = 0;
+
+	forAll(l, facei)
+	{
+		if (isBoundaryCell[l[facei]] || isBoundaryCell[u[facei]])
+		{
+			boundaryFaces[nBoundaryFaces++] = facei;
+		}
+	}
+
+	boundaryFaces.setSize(nBoundaryFaces);
+
+	// Publish the split once complete, the boundary cells last
+	splitPatches_ = patches;
+	boundaryFacesPtr_ = boundaryFacesPtr;
+	boundaryCellsPtr_ = boundaryCellsPtr;
+}
+
+
+void tnbLib::lduAddressing::calcCacheBlockFaceOrder() const
+{
+	if (cacheBlockFaceOrderPtr_)
+	{
+		FatalErrorInFunction
+			<< "cache-blocked face order already calculated"
+			<< abort(FatalError);
+	}
+
+	const labelUList& l = lowerAddr();
+	const labelUList& u = upperAddr();
+
+	// Two blocks of vector values are to fit in the cache
+	const label nCellsPerBlock =
+		max(label(cacheBlockSize / (6 * sizeof(scalar))), label(1));
+
+	const label nBlocks = (size() + nCellsPerBlock - 1) / nCellsPerBlock;
+
+	// The original order is kept, leave the lists empty
+	if (cacheBlockSize <= 0 || nBlocks <= 1)
+	{
+		cacheBlockFacePositionPtr_ = new labelList();
+		cacheBlockFaceOrderPtr_ = new labelList();
+
+		return;
+	}
+
+	labelList* orderPtr = new labelList(l.size());
+	labelList* positionPtr = new labelList(l.size());
+
+	labelList& order = *orderPtr;
+	labelList& position = *positionPtr;
+
+	// Sort on the upper block and then stably on the lower block, giving the
+	// faces ordered by (lower block, upper block)
+	labelList upperSorted(l.size());
+	sortFacesOnCellBlock
+	(
+		u,
+		nCellsPerBlock,
+		nBlocks,
+		identity(l.size()),
+		upperSorted
+	);
+	sortFacesOnCellBlock(l, nCellsPerBlock, nBlocks, upperSorted, order);
+
+	forAll(order, i)
+	{
+		position[order[i]] = i;
+	}
+
+	cacheBlockFacePositionPtr_ = positionPtr;
+	cacheBlockFaceOrderPtr_ = orderPtr;
 }
 
 
@@ -153,6 +421,13 @@ tnbLib::lduAddressing::~lduAddressing()
 	deleteDemandDrivenData(losortPtr_);
 	deleteDemandDrivenData(ownerStartPtr_);
 	deleteDemandDrivenData(losortStartPtr_);
+	deleteDemandDrivenData(threadBlockStartPtr_);
+	deleteDemandDrivenData(csrAddrPtr_);
+	deleteDemandDrivenData(levelSchedulePtr_);
+	deleteDemandDrivenData(boundaryCellsPtr_);
+	deleteDemandDrivenData(boundaryFacesPtr_);
+	deleteDemandDrivenData(cacheBlockFaceOrderPtr_);
+	deleteDemandDrivenData(cacheBlockFacePositionPtr_);
 }
 
 
@@ -160,6 +435,8 @@ tnbLib::lduAddressing::~lduAddressing()
 
 const tnbLib::labelUList& tnbLib::lduAddressing::losortAddr() const
 {
+	taskParallel::sharedLock lock;
+
 	if (!losortPtr_)
 	{
 		calcLosort();
@@ -171,6 +448,8 @@ const tnbLib::labelUList& tnbLib::lduAddressing::losortAddr() const
 
 const tnbLib::labelUList& tnbLib::lduAddressing::ownerStartAddr() const
 {
+	taskParallel::sharedLock lock;
+
 	if (!ownerStartPtr_)
 	{
 		calcOwnerStart();
@@ -182,6 +461,8 @@ const tnbLib::labelUList& tnbLib::lduAddressing::ownerStartAddr() const
 
 const tnbLib::labelUList& tnbLib::lduAddressing::losortStartAddr() const
 {
+	taskParallel::sharedLock lock;
+
 	if (!losortStartPtr_)
 	{
 		calcLosortStart();
@@ -191,6 +472,115 @@ const tnbLib::labelUList& tnbLib::lduAddressing::losortStartAddr() const
 }
 
 
+const tnbLib::labelUList& tnbLib::lduAddressing::threadBlockStartAddr() const
+{
+	taskParallel::sharedLock lock;
+
+	if
+		(
+			threadBlockStartPtr_
+			&& threadBlockNThreads_ != max(threadPool::nThreads, 1)
+			)
+	{
+		deleteDemandDrivenData(threadBlockStartPtr_);
+	}
+
+	if (!threadBlockStartPtr_)
+	{
+		calcThreadBlockStart();
+	}
+
+	return *threadBlockStartPtr_;
+}
+
+
+const tnbLib::lduCSRAddressing& tnbLib::lduAddressing::csrAddr() const
+{
+	taskParallel::sharedLock lock;
+
+	if (!csrAddrPtr_)
+	{
+		calcCSRAddr();
+	}
+
+	return *csrAddrPtr_;
+}
+
+
+const tnbLib::lduLevelSchedule& tnbLib::lduAddressing::levelSchedule() const
+{
+	taskParallel::sharedLock lock;
+
+	if (!levelSchedulePtr_)
+	{
+		calcLevelSchedule();
+	}
+
+	return *levelSchedulePtr_;
+}
+
+
+const tnbLib::labelUList& tnbLib::lduAddressing::boundaryCellAddr
+(
+	const boolUList& patches
+) const
+{
+	taskParallel::sharedLock lock;
+
+	calcInteriorBoundarySplit(patches);
+
+	return *boundaryCellsPtr_;
+}
+
+
+const tnbLib::labelUList& tnbLib::lduAddressing::boundaryFaceAddr
+(
+	const boolUList& patches
+) const
+{
+	taskParallel::sharedLock lock;
+
+	calcInteriorBoundarySplit(patches);
+
+	return *boundaryFacesPtr_;
+}
+
+
+const tnbLib::labelUList& tnbLib::lduAddressing::cacheBlockFaceOrder() const
+{
+	taskParallel::sharedLock lock;
+
+	if (!cacheBlockFaceOrderPtr_)
+	{
+		calcCacheBlockFaceOrder();
+	}
+
+	return *cacheBlockFaceOrderPtr_;
+}
+
+
+const tnbLib::labelUList& tnbLib::lduAddressing::cacheBlockFacePosition() const
+{
+	taskParallel::sharedLock lock;
+
+	if (!cacheBlockFacePositionPtr_)
+	{
+		calcCacheBlockFaceOrder();
+	}
+
+	return *cacheBlockFacePositionPtr_;
+}
+
+
+void tnbLib::lduAddressing::clearCacheBlockFaceOrder() const
+{
+	taskParallel::sharedLock lock;
+
+	deleteDemandDrivenData(cacheBlockFaceOrderPtr_);
+	deleteDemandDrivenData(cacheBlockFacePositionPtr_);
+}
+
+
 tnbLib::label tnbLib::lduAddressing::triIndex(const label a, const label b) const
 {
 	label own = min(a, b);
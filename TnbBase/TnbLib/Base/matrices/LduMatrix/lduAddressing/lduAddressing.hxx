@@ -92,12 +92,57 @@ Description
 	list. Thus, for every point the losort start gives the address of the
 	first face to neighbour this point.
 
+	For thread-parallel matrix operations the equations are split into
+	contiguous blocks of rows with approximately equal numbers of
+	coefficients. Each block only writes to its own rows, gathering the
+	face contributions through the owner start and losort addressing, so
+	the blocks are free of write conflicts. The block addressing is
+	calculated on demand for the number of threads set by the "nThreads"
+	optimisation switch. With NUMA first-touch placement (see firstTouch)
+	the blocks are instead of equal size, matching the parts of the arrays
+	placed by each thread.
+
+	The equivalent compressed sparse row addressing is also provided on
+	demand, see lduCSRAddressing, as is the level schedule of the triangular
+	sweeps of the incomplete factorisation preconditioners, see
+	lduLevelSchedule.
+
+	To overlap the exchange of the processor interface values with the
+	matrix operations the equations are split into the boundary cells,
+	adjacent to a given set of patches, and the remaining interior cells
+	which do not depend on the values received over these patches. The
+	boundary cells and the faces with at least one boundary cell are
+	calculated on demand and cached for the last set of patches.
+
+	For cache locality of the loops over the faces which scatter to the
+	cells the faces may be traversed in a cache-blocked order. The
+	equations are split into blocks of consecutive cells sized by the
+	"cacheBlockSize" optimisation switch, in bytes, such that two blocks
+	of vector values fit in the cache, and the faces are ordered by the
+	blocks of their lower and upper cells, preserving the original order
+	within each pair of blocks. The face order and its inverse form a
+	bijection with the original face numbering, which is left unchanged.
+	With the default of 0, or if the cells fit in a single block, the
+	original order is kept and the face order is empty, in which case the
+	loops traverse the faces contiguously.
+
+	Only the traversal changes: the faces and cells are not renumbered, so
+	with a blocked order every face array is read through the order rather
+	than sequentially, which can cost more than the cell locality gains.
+	The switch is therefore off by default and should only be set if
+	Test-cacheBlock shows a gain for the mesh and the machine.
+
+	The demand-driven data are calculated and returned under
+	taskParallel::sharedLock so that concurrent tasks may share the
+	addressing, and each list is only published once it is complete.
+
 SourceFiles
 	lduAddressing.C
 
 \*---------------------------------------------------------------------------*/
 
 #include <labelList.hxx>
+#include <boolList.hxx>
 #include <lduSchedule.hxx>
 #include <Tuple2.hxx>
 
@@ -106,6 +151,10 @@ SourceFiles
 namespace tnbLib
 {
 
+	// Forward declaration of classes
+	class lduCSRAddressing;
+	class lduLevelSchedule;
+
 	/*---------------------------------------------------------------------------*\
 							   Class lduAddressing Declaration
 	\*---------------------------------------------------------------------------*/
@@ -129,6 +178,33 @@ namespace tnbLib
 		//- Losort start addressing
 		mutable labelList* losortStartPtr_;
 
+		//- Thread block start addressing
+		mutable labelList* threadBlockStartPtr_;
+
+		//- Number of threads the thread blocks were calculated for
+		mutable label threadBlockNThreads_;
+
+		//- Compressed sparse row addressing
+		mutable lduCSRAddressing* csrAddrPtr_;
+
+		//- Level schedule of the triangular sweeps
+		mutable lduLevelSchedule* levelSchedulePtr_;
+
+		//- Patches the interior/boundary split was calculated for
+		mutable boolList splitPatches_;
+
+		//- Cells adjacent to the split patches in increasing order
+		mutable labelList* boundaryCellsPtr_;
+
+		//- Faces with at least one boundary cell in increasing order
+		mutable labelList* boundaryFacesPtr_;
+
+		//- Faces in cache-blocked order
+		mutable labelList* cacheBlockFaceOrderPtr_;
+
+		//- Position of the faces in the cache-blocked order
+		mutable labelList* cacheBlockFacePositionPtr_;
+
 
 		// Private Member Functions
 
@@ -141,9 +217,38 @@ namespace tnbLib
 		//- Calculate losort start
 		FoamBase_EXPORT void calcLosortStart() const;
 
+		//- Calculate thread block start
+		FoamBase_EXPORT void calcThreadBlockStart() const;
+
+		//- Calculate compressed sparse row addressing
+		FoamBase_EXPORT void calcCSRAddr() const;
+
+		//- Calculate the level schedule of the triangular sweeps
+		FoamBase_EXPORT void calcLevelSchedule() const;
+
+		//- Calculate the interior/boundary split for the given patches
+		//  unless already calculated for the same patches
+		FoamBase_EXPORT void calcInteriorBoundarySplit
+		(
+			const boolUList& patches
+		) const;
+
+		//- Calculate the cache-blocked face order and its inverse
+		FoamBase_EXPORT void calcCacheBlockFaceOrder() const;
+
 
 	public:
 
+		// Static Data
+
+			//- Minimum number of equations per thread block
+		static FoamBase_EXPORT const label minThreadBlockSize;
+
+		//- Size in bytes of the cache the face order is blocked for
+		//  (optimisation switch). 0 for the original face order.
+		static FoamBase_EXPORT int cacheBlockSize;
+
+
 		// Constructors
 
 		lduAddressing(const label nEqns)
@@ -151,7 +256,15 @@ namespace tnbLib
 			size_(nEqns),
 			losortPtr_(nullptr),
 			ownerStartPtr_(nullptr),
-			losortStartPtr_(nullptr)
+			losortStartPtr_(nullptr),
+			threadBlockStartPtr_(nullptr),
+			threadBlockNThreads_(0),
+			csrAddrPtr_(nullptr),
+			levelSchedulePtr_(nullptr),
+			boundaryCellsPtr_(nullptr),
+			boundaryFacesPtr_(nullptr),
+			cacheBlockFaceOrderPtr_(nullptr),
+			cacheBlockFacePositionPtr_(nullptr)
 		{}
 
 		//- Disallow default bitwise copy construction
@@ -194,6 +307,52 @@ namespace tnbLib
 		//- Return losort start addressing
 		FoamBase_EXPORT const labelUList& losortStartAddr() const;
 
+		//- Return start of the blocks of equations for thread-parallel
+		//  operations. Size is the number of blocks + 1.
+		FoamBase_EXPORT const labelUList& threadBlockStartAddr() const;
+
+		//- Return the number of blocks of equations for thread-parallel
+		//  operations. 1 if the operations are to be executed serially.
+		label nThreadBlocks() const
+		{
+			return threadBlockStartAddr().size() - 1;
+		}
+
+		//- Return the equivalent compressed sparse row addressing
+		FoamBase_EXPORT const lduCSRAddressing& csrAddr() const;
+
+		//- Return the level schedule of the triangular sweeps
+		FoamBase_EXPORT const lduLevelSchedule& levelSchedule() const;
+
+		//- Return the cells adjacent to the selected patches in increasing
+		//  order. The rows of the other (interior) cells do not depend on
+		//  the values of these patches.
+		FoamBase_EXPORT const labelUList& boundaryCellAddr
+		(
+			const boolUList& patches
+		) const;
+
+		//- Return the faces with at least one cell adjacent to the
+		//  selected patches in increasing order
+		FoamBase_EXPORT const labelUList& boundaryFaceAddr
+		(
+			const boolUList& patches
+		) const;
+
+		//- Return the faces in cache-blocked order,
+		//  i.e. the original index of each face of the blocked order.
+		//  Empty if the original order is kept.
+		FoamBase_EXPORT const labelUList& cacheBlockFaceOrder() const;
+
+		//- Return the position of each face in the cache-blocked order,
+		//  the inverse of cacheBlockFaceOrder. Empty if the original order
+		//  is kept.
+		FoamBase_EXPORT const labelUList& cacheBlockFacePosition() const;
+
+		//- Clear the cache-blocked face order so that it is calculated
+		//  again for the current value of cacheBlockSize
+		FoamBase_EXPORT void clearCacheBlockFaceOrder() const;
+
 		//- Return off-diagonal index given owner and neighbour label
 		FoamBase_EXPORT label triIndex(const label a, const label b) const;
 
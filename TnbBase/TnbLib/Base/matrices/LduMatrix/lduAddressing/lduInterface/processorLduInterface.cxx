@@ -1,5 +1,7 @@
 #include <processorLduInterface.hxx>
 
+#include <UPstream.hxx>
+
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
 namespace tnbLib
@@ -38,4 +40,12 @@ tnbLib::processorLduInterface::~processorLduInterface()
 {}
 
 
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool tnbLib::processorLduInterface::sharedMemory() const
+{
+	return UPstream::sharedMemoryPeer(neighbProcNo(), comm());
+}
+
+
 // ************************************************************************* //
\ No newline at end of file
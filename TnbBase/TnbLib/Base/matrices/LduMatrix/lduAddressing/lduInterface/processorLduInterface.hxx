@@ -31,6 +31,12 @@ Class
 Description
 	An abstract base class for processor coupled interfaces.
 
+	If the neighbour processor is on the same node and the
+	sharedMemoryBufferSize optimisation switch is set the transfers go
+	through the shared-memory window of the node: the values are copied
+	into the window on send and copied straight out of the neighbour's part
+	of the window on receive, without compression.
+
 SourceFiles
 	processorLduInterface.C
 	processorLduInterfaceTemplates.C
@@ -104,6 +110,10 @@ namespace tnbLib
 		//- Return message tag used for sending
 		FoamBase_EXPORT virtual int tag() const = 0;
 
+		//- Return true if the transfers go through the shared-memory
+		//  window of the node, see UPstream::sharedMemoryPeer
+		FoamBase_EXPORT bool sharedMemory() const;
+
 		// Transfer functions
 
 			//- Raw send function
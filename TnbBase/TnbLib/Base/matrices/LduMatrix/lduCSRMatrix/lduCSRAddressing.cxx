@@ -0,0 +1,69 @@
+#include <lduCSRAddressing.hxx>
+
+#include <lduAddressing.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::lduCSRAddressing::lduCSRAddressing(const lduAddressing& addr)
+	:
+	rowStart_(addr.size() + 1),
+	column_(addr.size() + 2 * addr.lowerAddr().size()),
+	lduCoeff_(column_.size())
+{
+	const label nCells = addr.size();
+	const label nFaces = addr.lowerAddr().size();
+
+	const labelUList& l = addr.lowerAddr();
+	const labelUList& u = addr.upperAddr();
+
+	const labelUList& ownStart = addr.ownerStartAddr();
+	const labelUList& losort = addr.losortAddr();
+	const labelUList& losortStart = addr.losortStartAddr();
+
+	label coeffi = 0;
+
+	for (label celli = 0; celli < nCells; celli++)
+	{
+		rowStart_[celli] = coeffi;
+
+		// Lower-triangle coefficients: faces neighbouring this cell,
+		// in ascending owner order
+		for
+			(
+				label i = losortStart[celli];
+				i < losortStart[celli + 1];
+				i++
+				)
+		{
+			const label facei = losort[i];
+
+			column_[coeffi] = l[facei];
+			lduCoeff_[coeffi] = nCells + nFaces + facei;
+			coeffi++;
+		}
+
+		// Diagonal coefficient
+		column_[coeffi] = celli;
+		lduCoeff_[coeffi] = celli;
+		coeffi++;
+
+		// Upper-triangle coefficients: faces owned by this cell,
+		// in ascending neighbour order
+		for
+			(
+				label facei = ownStart[celli];
+				facei < ownStart[celli + 1];
+				facei++
+				)
+		{
+			column_[coeffi] = u[facei];
+			lduCoeff_[coeffi] = nCells + facei;
+			coeffi++;
+		}
+	}
+
+	rowStart_[nCells] = coeffi;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,195 @@
+#include <lduCSRMatrix.hxx>
+
+#include <lduMatrix.hxx>
+#include <threadPool.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::lduCSRMatrix::lduCSRMatrix(const lduMatrix& A)
+	:
+	lduAddr_(A.lduAddr()),
+	addr_(A.lduAddr().csrAddr()),
+	coeffs_(addr_.nCoeffs())
+{
+	const label nCells = lduAddr_.size();
+	const label nFaces = lduAddr_.lowerAddr().size();
+
+	const scalar* const __restrict diagPtr = A.diag().begin();
+	const scalar* const __restrict upperPtr = A.upper().begin();
+	const scalar* const __restrict lowerPtr = A.lower().begin();
+
+	const label* const __restrict lduCoeffPtr = addr_.lduCoeff().begin();
+
+	scalar* __restrict coeffsPtr = coeffs_.begin();
+
+	const label nCoeffs = coeffs_.size();
+
+	for (label coeffi = 0; coeffi < nCoeffs; coeffi++)
+	{
+		const label i = lduCoeffPtr[coeffi];
+
+		if (i < nCells)
+		{
+			coeffsPtr[coeffi] = diagPtr[i];
+		}
+		else if (i < nCells + nFaces)
+		{
+			coeffsPtr[coeffi] = upperPtr[i - nCells];
+		}
+		else
+		{
+			coeffsPtr[coeffi] = lowerPtr[i - nCells - nFaces];
+		}
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::lduCSRMatrix::Amul
+(
+	scalarField& Apsi,
+	const scalarField& psi
+) const
+{
+	scalar* __restrict ApsiPtr = Apsi.begin();
+
+	const scalar* const __restrict psiPtr = psi.begin();
+	const scalar* const __restrict coeffsPtr = coeffs_.begin();
+
+	const label* const __restrict rowStartPtr = addr_.rowStart().begin();
+	const label* const __restrict columnPtr = addr_.column().begin();
+
+	const label* const __restrict blockStartPtr =
+		lduAddr_.threadBlockStartAddr().begin();
+
+	threadPool::global().parallelFor
+	(
+		lduAddr_.nThreadBlocks(),
+		[&](const label blocki)
+		{
+			const label cellEnd = blockStartPtr[blocki + 1];
+
+			for
+				(
+					label cell = blockStartPtr[blocki];
+					cell < cellEnd;
+					cell++
+					)
+			{
+				scalar ApsiCell = 0;
+
+				for
+					(
+						label coeffi = rowStartPtr[cell];
+						coeffi < rowStartPtr[cell + 1];
+						coeffi++
+						)
+				{
+					ApsiCell += coeffsPtr[coeffi] * psiPtr[columnPtr[coeffi]];
+				}
+
+				ApsiPtr[cell] = ApsiCell;
+			}
+		}
+	);
+}
+
+
+void tnbLib::lduCSRMatrix::sumA(scalarField& sumA) const
+{
+	scalar* __restrict sumAPtr = sumA.begin();
+
+	const scalar* const __restrict coeffsPtr = coeffs_.begin();
+
+	const label* const __restrict rowStartPtr = addr_.rowStart().begin();
+
+	const label* const __restrict blockStartPtr =
+		lduAddr_.threadBlockStartAddr().begin();
+
+	threadPool::global().parallelFor
+	(
+		lduAddr_.nThreadBlocks(),
+		[&](const label blocki)
+		{
+			const label cellEnd = blockStartPtr[blocki + 1];
+
+			for
+				(
+					label cell = blockStartPtr[blocki];
+					cell < cellEnd;
+					cell++
+					)
+			{
+				scalar sumACell = 0;
+
+				for
+					(
+						label coeffi = rowStartPtr[cell];
+						coeffi < rowStartPtr[cell + 1];
+						coeffi++
+						)
+				{
+					sumACell += coeffsPtr[coeffi];
+				}
+
+				sumAPtr[cell] = sumACell;
+			}
+		}
+	);
+}
+
+
+void tnbLib::lduCSRMatrix::residual
+(
+	scalarField& rA,
+	const scalarField& psi,
+	const scalarField& source
+) const
+{
+	scalar* __restrict rAPtr = rA.begin();
+
+	const scalar* const __restrict psiPtr = psi.begin();
+	const scalar* const __restrict sourcePtr = source.begin();
+	const scalar* const __restrict coeffsPtr = coeffs_.begin();
+
+	const label* const __restrict rowStartPtr = addr_.rowStart().begin();
+	const label* const __restrict columnPtr = addr_.column().begin();
+
+	const label* const __restrict blockStartPtr =
+		lduAddr_.threadBlockStartAddr().begin();
+
+	threadPool::global().parallelFor
+	(
+		lduAddr_.nThreadBlocks(),
+		[&](const label blocki)
+		{
+			const label cellEnd = blockStartPtr[blocki + 1];
+
+			for
+				(
+					label cell = blockStartPtr[blocki];
+					cell < cellEnd;
+					cell++
+					)
+			{
+				scalar rACell = sourcePtr[cell];
+
+				for
+					(
+						label coeffi = rowStartPtr[cell];
+						coeffi < rowStartPtr[cell + 1];
+						coeffi++
+						)
+				{
+					rACell -= coeffsPtr[coeffi] * psiPtr[columnPtr[coeffi]];
+				}
+
+				rAPtr[cell] = rACell;
+			}
+		}
+	);
+}
+
+
+// ************************************************************************* //
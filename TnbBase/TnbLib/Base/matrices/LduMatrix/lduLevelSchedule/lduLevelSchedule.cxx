@@ -0,0 +1,103 @@
+#include <lduLevelSchedule.hxx>
+
+#include <lduAddressing.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+const tnbLib::label tnbLib::lduLevelSchedule::minLevelBlockSize = 256;
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void tnbLib::lduLevelSchedule::sortByLevel
+(
+	const labelList& level,
+	labelList& cells,
+	labelList& levelStart
+)
+{
+	label nLevels = 0;
+
+	forAll(level, celli)
+	{
+		nLevels = max(nLevels, level[celli] + 1);
+	}
+
+	// Count the cells of each level
+	levelStart.setSize(nLevels + 1);
+	levelStart = 0;
+
+	forAll(level, celli)
+	{
+		levelStart[level[celli] + 1]++;
+	}
+
+	for (label leveli = 0; leveli < nLevels; leveli++)
+	{
+		levelStart[leveli + 1] += levelStart[leveli];
+	}
+
+	// Distribute the cells, in increasing order within each level
+	labelList nCells(nLevels, 0);
+	cells.setSize(level.size());
+
+	forAll(level, celli)
+	{
+		const label leveli = level[celli];
+		cells[levelStart[leveli] + nCells[leveli]++] = celli;
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::lduLevelSchedule::lduLevelSchedule(const lduAddressing& addr)
+{
+	const label nCells = addr.size();
+
+	const labelUList& l = addr.lowerAddr();
+	const labelUList& u = addr.upperAddr();
+
+	const labelUList& ownStart = addr.ownerStartAddr();
+	const labelUList& losort = addr.losortAddr();
+	const labelUList& losortStart = addr.losortStartAddr();
+
+	labelList level(nCells, 0);
+
+	// Forward sweep: a cell follows its lower neighbours
+	for (label celli = 0; celli < nCells; celli++)
+	{
+		for
+			(
+				label i = losortStart[celli];
+				i < losortStart[celli + 1];
+				i++
+				)
+		{
+			level[celli] = max(level[celli], level[l[losort[i]]] + 1);
+		}
+	}
+
+	sortByLevel(level, lowerCells_, lowerLevelStart_);
+
+	// Backward sweep: a cell follows its upper neighbours
+	level = 0;
+
+	for (label celli = nCells - 1; celli >= 0; celli--)
+	{
+		for
+			(
+				label facei = ownStart[celli];
+				facei < ownStart[celli + 1];
+				facei++
+				)
+		{
+			level[celli] = max(level[celli], level[u[facei]] + 1);
+		}
+	}
+
+	sortByLevel(level, upperCells_, upperLevelStart_);
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,60 @@
+#pragma once
+#include <threadPool.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class RowOp>
+void tnbLib::lduLevelSchedule::sweep
+(
+	const labelList& cells,
+	const labelList& levelStart,
+	const RowOp& rowOp
+)
+{
+	threadPool& pool = threadPool::global();
+
+	const label* const __restrict cellsPtr = cells.begin();
+
+	const label nLevels = levelStart.size() - 1;
+
+	for (label leveli = 0; leveli < nLevels; leveli++)
+	{
+		const label start = levelStart[leveli];
+		const label size = levelStart[leveli + 1] - start;
+
+		const label nBlocks =
+			max(min(pool.size(), size / minLevelBlockSize), label(1));
+
+		if (nBlocks == 1)
+		{
+			for (label i = start; i < start + size; i++)
+			{
+				rowOp(cellsPtr[i]);
+			}
+		}
+		else
+		{
+			pool.parallelFor
+			(
+				nBlocks,
+				[&](const label blocki)
+				{
+					const label blockEnd = start + (size*(blocki + 1))/nBlocks;
+
+					for
+						(
+							label i = start + (size*blocki)/nBlocks;
+							i < blockEnd;
+							i++
+							)
+					{
+						rowOp(cellsPtr[i]);
+					}
+				}
+			);
+		}
+	}
+}
+
+
+// ************************************************************************* //
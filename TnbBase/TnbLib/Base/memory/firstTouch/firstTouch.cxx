@@ -0,0 +1,207 @@
+#include <firstTouch.hxx>
+
+#include <threadPool.hxx>
+#include <registerSwitch.hxx>
+#include <IOstreams.hxx>
+
+#include <cstdint>
+
+#if defined(__linux__)
+	#include <unistd.h>
+	#include <sys/syscall.h>
+#endif
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+int tnbLib::firstTouch::numaFirstTouch
+(
+	tnbLib::debug::optimisationSwitch("numaFirstTouch", 0)
+);
+
+registerOptSwitch
+(
+	"numaFirstTouch",
+	int,
+	tnbLib::firstTouch::numaFirstTouch
+);
+
+const size_t tnbLib::firstTouch::minBytes = 1048576;
+
+const size_t tnbLib::firstTouch::pageSize = 4096;
+
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	//- Return the start of part i of n of the given number of bytes
+	static inline size_t partStart
+	(
+		const size_t nBytes,
+		const label i,
+		const label n
+	)
+	{
+		return size_t(double(nBytes)*i / n);
+	}
+}
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+void tnbLib::firstTouch::touch(void* p, const size_t nBytes)
+{
+	// Nested calls from a pool task are placed by the calling thread anyway
+	if (threadPool::inTask() || threadPool::nThreads <= 1)
+	{
+		return;
+	}
+
+	threadPool& pool = threadPool::global();
+
+	const label nParts = pool.size();
+	volatile char* const bytes = static_cast<char*>(p);
+
+	pool.parallelFor
+	(
+		nParts,
+		[&](const label parti)
+		{
+			const size_t start = partStart(nBytes, parti, nParts);
+			const size_t end = partStart(nBytes, parti + 1, nParts);
+
+			if (start >= end)
+			{
+				return;
+			}
+
+			// The first byte, then the first byte of each following page
+			bytes[start] = bytes[start];
+
+			const size_t offset = reinterpret_cast<uintptr_t>(bytes) % pageSize;
+
+			for
+				(
+					size_t i = start + pageSize - (start + offset) % pageSize;
+					i < end;
+					i += pageSize
+					)
+			{
+				bytes[i] = bytes[i];
+			}
+		}
+	);
+}
+
+
+tnbLib::List<tnbLib::label> tnbLib::firstTouch::pageNodes
+(
+	const void* p,
+	const size_t nBytes
+)
+{
+	const uintptr_t first = reinterpret_cast<uintptr_t>(p) / pageSize;
+	const uintptr_t last =
+		(reinterpret_cast<uintptr_t>(p) + max(nBytes, size_t(1)) - 1)
+		/ pageSize;
+
+	List<label> nodes(label(last - first + 1), label(-1));
+
+#if defined(__linux__) && defined(SYS_move_pages)
+	List<void*> pages(nodes.size());
+	List<int> status(nodes.size(), -1);
+
+	forAll(pages, i)
+	{
+		pages[i] = reinterpret_cast<void*>((first + i)*pageSize);
+	}
+
+	// Query only (no target nodes) for the calling process
+	if
+	(
+		syscall
+		(
+			SYS_move_pages,
+			0,
+			static_cast<unsigned long>(pages.size()),
+			pages.begin(),
+			nullptr,
+			status.begin(),
+			0
+		) == 0
+	)
+	{
+		forAll(nodes, i)
+		{
+			nodes[i] = status[i] >= 0 ? status[i] : -1;
+		}
+	}
+#endif
+
+	return nodes;
+}
+
+
+void tnbLib::firstTouch::writePlacement
+(
+	Ostream& os,
+	const char* name,
+	const void* p,
+	const size_t nBytes
+)
+{
+	const List<label> nodes(pageNodes(p, nBytes));
+
+	label nNodes = 0;
+	forAll(nodes, i)
+	{
+		nNodes = max(nNodes, nodes[i] + 1);
+	}
+
+	os << "NUMA placement of " << name << " (" << nodes.size()
+		<< " pages)" << nl;
+
+	if (nNodes == 0)
+	{
+		os << "    not available" << endl;
+		return;
+	}
+
+	// Pages per node of each thread part
+	const label nParts = max(threadPool::nThreads, 1);
+
+	for (label parti = 0; parti < nParts; parti++)
+	{
+		const label start = partStart(nodes.size(), parti, nParts);
+		const label end = partStart(nodes.size(), parti + 1, nParts);
+
+		List<label> nPages(nNodes, label(0));
+		label nUnknown = 0;
+
+		for (label i = start; i < end; i++)
+		{
+			if (nodes[i] >= 0)
+			{
+				nPages[nodes[i]]++;
+			}
+			else
+			{
+				nUnknown++;
+			}
+		}
+
+		os << "    part " << parti << " : pages per node " << nPages;
+
+		if (nUnknown)
+		{
+			os << ", not placed " << nUnknown;
+		}
+
+		os << nl;
+	}
+
+	os << endl;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,190 @@
+#include <listPool.hxx>
+
+#include <IOstreams.hxx>
+
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+const size_t tnbLib::listPool::minBlockSize = 1024;
+
+const tnbLib::label tnbLib::listPool::maxFreeBlocks = 64;
+
+const size_t tnbLib::listPool::maxFreeBytes = size_t(1) << 30;
+
+namespace tnbLib
+{
+	//- Free blocks and statistics of a block size
+	struct listPoolSizeClass
+	{
+		std::vector<void*> freeBlocks;
+		label nHits = 0;
+		label nMisses = 0;
+	};
+
+	//- Pool state. Constructed on first use and never destroyed so that
+	//  Lists constructed or destroyed during static initialisation or
+	//  destruction are served.
+	struct listPoolData
+	{
+		std::mutex mutex;
+		std::map<size_t, listPoolSizeClass> sizeClasses;
+		size_t freeBytes = 0;
+		label nAllocs = 0;
+		label nSmallAllocs = 0;
+	};
+
+	static listPoolData& listPoolState()
+	{
+		static listPoolData* dataPtr = new listPoolData();
+		return *dataPtr;
+	}
+}
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+void* tnbLib::listPool::allocate(const size_t nBytes)
+{
+	listPoolData& data = listPoolState();
+
+	char* block = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		data.nAllocs++;
+
+		if (nBytes < minBlockSize)
+		{
+			data.nSmallAllocs++;
+		}
+		else
+		{
+			listPoolSizeClass& sizeClass = data.sizeClasses[nBytes];
+
+			if (sizeClass.freeBlocks.size())
+			{
+				block = static_cast<char*>(sizeClass.freeBlocks.back());
+				sizeClass.freeBlocks.pop_back();
+				sizeClass.nHits++;
+				data.freeBytes -= nBytes;
+			}
+			else
+			{
+				sizeClass.nMisses++;
+			}
+		}
+	}
+
+	if (!block)
+	{
+		block = static_cast<char*>(::operator new(headerSize + nBytes));
+		*reinterpret_cast<size_t*>(block) = nBytes;
+	}
+
+	return block + headerSize;
+}
+
+
+void tnbLib::listPool::deallocate(void* ptr)
+{
+	if (!ptr)
+	{
+		return;
+	}
+
+	char* block = static_cast<char*>(ptr) - headerSize;
+	const size_t nBytes = *reinterpret_cast<size_t*>(block);
+
+	if (nBytes >= minBlockSize)
+	{
+		listPoolData& data = listPoolState();
+
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		listPoolSizeClass& sizeClass = data.sizeClasses[nBytes];
+
+		if
+		(
+			label(sizeClass.freeBlocks.size()) < maxFreeBlocks
+		 && data.freeBytes + nBytes <= maxFreeBytes
+		)
+		{
+			sizeClass.freeBlocks.push_back(block);
+			data.freeBytes += nBytes;
+			return;
+		}
+	}
+
+	::operator delete(block);
+}
+
+
+void tnbLib::listPool::clear()
+{
+	listPoolData& data = listPoolState();
+
+	std::lock_guard<std::mutex> lock(data.mutex);
+
+	for (auto& sizeClass : data.sizeClasses)
+	{
+		for (void* block : sizeClass.second.freeBlocks)
+		{
+			::operator delete(block);
+		}
+
+		sizeClass.second.freeBlocks.clear();
+	}
+
+	data.freeBytes = 0;
+}
+
+
+bool tnbLib::listPool::used()
+{
+	return listPoolState().nAllocs > 0;
+}
+
+
+void tnbLib::listPool::writeStatistics(Ostream& os)
+{
+	listPoolData& data = listPoolState();
+
+	std::lock_guard<std::mutex> lock(data.mutex);
+
+	label nHits = 0;
+	label nMisses = 0;
+
+	for (const auto& sizeClass : data.sizeClasses)
+	{
+		nHits += sizeClass.second.nHits;
+		nMisses += sizeClass.second.nMisses;
+	}
+
+	os << "listPool : allocations " << data.nAllocs
+		<< ", below " << label(minBlockSize) << " bytes "
+		<< data.nSmallAllocs
+		<< ", hits " << nHits
+		<< ", misses " << nMisses
+		<< ", free " << label(data.freeBytes) << " bytes" << nl;
+
+	os << "    " << "block size" << tab << "hits" << tab << "misses" << tab
+		<< "free blocks" << nl;
+
+	for (const auto& sizeClass : data.sizeClasses)
+	{
+		os << "    " << label(sizeClass.first)
+			<< tab << sizeClass.second.nHits
+			<< tab << sizeClass.second.nMisses
+			<< tab << label(sizeClass.second.freeBlocks.size()) << nl;
+	}
+
+	os << endl;
+}
+
+
+// ************************************************************************* //
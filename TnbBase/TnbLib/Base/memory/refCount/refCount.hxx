@@ -31,6 +31,12 @@ Class
 Description
 	Reference counter for various OpenFOAM components.
 
+	If compiled with USEATOMICREFCOUNT the count is atomic so that objects
+	may be referenced and released by temporaries on different threads,
+	which is required for the concurrent evaluation of independent terms,
+	see taskParallel. Otherwise the count is a plain int and the tasks are
+	executed serially.
+
 See also
 	tnbLib::tmp
 	tnbLib::token::compound
@@ -39,6 +45,10 @@ See also
 
 #include <bool.hxx>
 
+#ifdef USEATOMICREFCOUNT
+	#include <atomic>
+#endif
+
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 namespace tnbLib
@@ -52,7 +62,11 @@ namespace tnbLib
 	{
 		// Private Data
 
+#ifdef USEATOMICREFCOUNT
+		std::atomic<int> count_;
+#else
 		int count_;
+#endif
 
 
 		// Private Member Functions
@@ -77,6 +91,16 @@ namespace tnbLib
 
 	public:
 
+		// Static Data
+
+			//- Is the reference count thread-safe
+#ifdef USEATOMICREFCOUNT
+		static constexpr bool threadSafe = true;
+#else
+		static constexpr bool threadSafe = false;
+#endif
+
+
 		// Member Functions
 
 			//- Return the current reference count
@@ -91,6 +115,30 @@ namespace tnbLib
 			return count_ == 0;
 		}
 
+		//- Decrement the reference count unless it is zero, returning
+		//  true if it was zero, i.e. if the caller held the last reference.
+		//  Unlike unique() followed by operator--() this is atomic.
+		bool releaseRef()
+		{
+#ifdef USEATOMICREFCOUNT
+			int count = count_.load();
+
+			while (count && !count_.compare_exchange_weak(count, count - 1))
+			{}
+
+			return count == 0;
+#else
+			if (count_ == 0)
+			{
+				return true;
+			}
+
+			count_--;
+
+			return false;
+#endif
+		}
+
 
 		// Member Operators
 
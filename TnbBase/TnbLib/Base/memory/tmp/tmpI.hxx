@@ -207,16 +207,12 @@ inline void tnbLib::tmp<T>::clear() const
 {
 	if (isTmp() && ptr_)
 	{
-		if (ptr_->unique())
+		if (ptr_->releaseRef())
 		{
 			delete ptr_;
-			ptr_ = 0;
-		}
-		else
-		{
-			ptr_->operator--();
-			ptr_ = 0;
 		}
+
+		ptr_ = 0;
 	}
 }
 
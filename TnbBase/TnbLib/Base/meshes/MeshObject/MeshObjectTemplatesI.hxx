@@ -1,5 +1,6 @@
 #pragma once
 #include <IOstreams.hxx>
+#include <taskParallel.hxx>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -19,6 +20,9 @@ const Type& tnbLib::MeshObject<Mesh, MeshObjectType, Type>::New
 	const Mesh& mesh
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			mesh.thisDb().objectRegistry::template foundObject<Type>
@@ -58,6 +62,9 @@ const Type& tnbLib::MeshObject<Mesh, MeshObjectType, Type>::New
 	const Data1& d
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			mesh.thisDb().objectRegistry::template foundObject<Type>
@@ -98,6 +105,9 @@ const Type& tnbLib::MeshObject<Mesh, MeshObjectType, Type>::New
 	const Data2& d2
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			mesh.thisDb().objectRegistry::template foundObject<Type>
@@ -141,6 +151,9 @@ const Type& tnbLib::MeshObject<Mesh, MeshObjectType, Type>::New
 	const Data3& d3
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			mesh.thisDb().objectRegistry::template foundObject<Type>
@@ -182,6 +195,9 @@ const Type& tnbLib::MeshObject<Mesh, MeshObjectType, Type>::New
 	const Data4& d4
 )
 {
+	// Serialise the lookup and construction between concurrent tasks
+	taskParallel::sharedLock lock;
+
 	if
 		(
 			mesh.thisDb().objectRegistry::template foundObject<Type>
@@ -1,5 +1,6 @@
 #pragma once
 #include <Time.hxx>
+#include <taskParallel.hxx>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -55,6 +56,8 @@ void tnbLib::Residuals<Type>::append
 	const SolverPerformance<Type>& sp
 )
 {
+	taskParallel::sharedLock lock;
+
 	Residuals<Type>& residuals = const_cast<Residuals<Type>&>
 		(
 			MeshObject<polyMesh, GeometricMeshObject, Residuals<Type>>::New
@@ -11,6 +11,7 @@
 #include <treeDataCell.hxx>
 #include <MeshObject.hxx>
 #include <pointMesh.hxx>
+#include <listPool.hxx>
 
 #include <PstreamReduceOps.hxx> // added by amir
 #include <SubField.hxx> // added by amir
@@ -754,6 +755,9 @@ tnbLib::polyMesh::~polyMesh()
 {
 	clearOut();
 	resetMotion();
+
+	// Release the free list blocks, which were sized for this mesh
+	listPool::clear();
 }
 
 
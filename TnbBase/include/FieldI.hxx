@@ -94,6 +94,16 @@ tnbLib::Field<Type>::Field(const tmp<Field<Type>>& tf)
 }
 
 
+template<class Type>
+template<class Expr>
+tnbLib::Field<Type>::Field(const FieldExpression<Expr>& expr)
+	:
+	List<Type>(expr().size())
+{
+	operator=(expr);
+}
+
+
 template<class Type>
 tnbLib::Field<Type>::Field
 (
@@ -587,6 +597,38 @@ void tnbLib::Field<Type>::operator=(const VectorSpace<Form, Cmpt, nCmpt>& vs)
 }
 
 
+#define EXPRESSION_ASSIGNMENT(op)                                              \
+                                                                               \
+template<class Type>                                                           \
+template<class Expr>                                                           \
+void tnbLib::Field<Type>::operator op(const FieldExpression<Expr>& expr)        \
+{                                                                              \
+    const Expr& e = expr();                                                    \
+                                                                               \
+    if (e.size() != this->size())                                              \
+    {                                                                          \
+        FatalErrorInFunction                                                   \
+            << "Size of the expression " << e.size()                           \
+            << " differs from that of the field " << this->size()              \
+            << abort(FatalError);                                              \
+    }                                                                          \
+                                                                               \
+    Type* fPtr = this->begin();                                                \
+    const label n = this->size();                                              \
+                                                                               \
+    for (label i = 0; i < n; i++)                                              \
+    {                                                                          \
+        fPtr[i] op e[i];                                                       \
+    }                                                                          \
+}
+
+EXPRESSION_ASSIGNMENT(=)
+EXPRESSION_ASSIGNMENT(+=)
+EXPRESSION_ASSIGNMENT(-=)
+
+#undef EXPRESSION_ASSIGNMENT
+
+
 //#define COMPUTED_ASSIGNMENT(TYPE, op)                                          \
 //                                                                               \
 //template<class Type>                                                           \
@@ -32,7 +32,10 @@ Description
 	A 1D array of objects of type \<T\>, where the size of the vector
 	is known and used for subscript bounds checking, etc.
 
-	Storage is allocated on free-store during construction.
+	Storage is allocated on free-store during construction. If compiled
+	with USELISTPOOL the storage of trivially destructible types is
+	obtained from and returned to listPool. Otherwise large storage is placed
+	by the threads if NUMA first-touch placement is enabled, see firstTouch.
 
 SourceFiles
 	List.C
@@ -43,6 +46,8 @@ SourceFiles
 
 #include <UList.hxx>
 #include <autoPtr.hxx>
+#include <listPool.hxx>
+#include <firstTouch.hxx>
 
 #include <initializer_list>
 
@@ -92,11 +97,19 @@ namespace tnbLib
 	\*---------------------------------------------------------------------------*/
 
 	template<class T>
-	class List : public UList<T>
+	class List
+		:
+		public UList<T>
 	{
 		// Private Member Functions
 
-			//- Allocate list storage
+			//- Return new storage for the given number of elements
+		static inline T* newArray(const label n);
+
+		//- Release storage obtained from newArray
+		static inline void deleteArray(T* v);
+
+		//- Allocate list storage
 		inline void alloc();
 
 		//- Reallocate list storage to the given size
@@ -0,0 +1,634 @@
+#pragma once
+#include <ListOps.hxx>
+#include <IOstreams.hxx>
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::readControls()
+{
+	const word solverName(controlDict_.lookup("solver"));
+
+	if (solverName != "PBiCGStab")
+	{
+		FatalIOErrorInFunction(controlDict_)
+			<< "Unknown solver " << solverName
+			<< " for the multiComponent solution of " << fieldName_
+			<< "; currently the supported solver is PBiCGStab"
+			<< exit(FatalIOError);
+	}
+
+	maxIter_ = controlDict_.lookupOrDefault<label>("maxIter", 1000);
+	minIter_ = controlDict_.lookupOrDefault<label>("minIter", 0);
+	tolerance_ = controlDict_.lookupOrDefault<scalar>("tolerance", 1e-6);
+	relTol_ = controlDict_.lookupOrDefault<scalar>("relTol", 0);
+}
+
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::calcReciprocalD()
+{
+	const Type one(pTraits<Type>::one);
+
+	Type* __restrict rDPtr = rD_.begin();
+
+	if (preconditionerName_ == "DILU" || preconditionerName_ == "DIC")
+	{
+		const label* const __restrict uPtr =
+			matrix_.lduAddr().upperAddr().begin();
+		const label* const __restrict lPtr =
+			matrix_.lduAddr().lowerAddr().begin();
+
+		const scalar* const __restrict upperPtr = matrix_.upper().begin();
+		const scalar* const __restrict lowerPtr = matrix_.lower().begin();
+
+		const label nFaces = matrix_.upper().size();
+		for (label face = 0; face < nFaces; face++)
+		{
+			rDPtr[uPtr[face]] -=
+				upperPtr[face] * lowerPtr[face]
+				* cmptDivide(one, rDPtr[lPtr[face]]);
+		}
+	}
+	else if (preconditionerName_ != "diagonal" && preconditionerName_ != "none")
+	{
+		FatalIOErrorInFunction(controlDict_)
+			<< "Unknown preconditioner " << preconditionerName_
+			<< " for the multiComponent solution of " << fieldName_
+			<< "; currently supported preconditioners are"
+			<< " DILU, DIC, diagonal and none"
+			<< exit(FatalIOError);
+	}
+
+	// Calculate the reciprocal of the preconditioned diagonal
+	const label nCells = rD_.size();
+	for (label cell = 0; cell < nCells; cell++)
+	{
+		rDPtr[cell] = cmptDivide(one, rDPtr[cell]);
+	}
+
+	// Components which are not solved for are not preconditioned
+	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+	{
+		if (validComponents_[cmpt] == -1)
+		{
+			rD_.replace(cmpt, scalar(0));
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::calcInterfaceCells()
+{
+	boolList isInterfaceCell(diag_.size(), false);
+
+	forAll(interfaces_, patchi)
+	{
+		if (interfaces_.set(patchi))
+		{
+			const labelUList& pa = matrix_.lduAddr().patchAddr(patchi);
+
+			forAll(pa, face)
+			{
+				isInterfaceCell[pa[face]] = true;
+			}
+		}
+	}
+
+	interfaceCells_ = findIndices(isInterfaceCell, true);
+}
+
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::Amul
+(
+	Field<Type>& Apsi,
+	const Field<Type>& psi
+) const
+{
+	Type* __restrict ApsiPtr = Apsi.begin();
+
+	const Type* const __restrict psiPtr = psi.begin();
+	const Type* const __restrict diagPtr = diag_.begin();
+
+	const label* const __restrict uPtr = matrix_.lduAddr().upperAddr().begin();
+	const label* const __restrict lPtr = matrix_.lduAddr().lowerAddr().begin();
+
+	const scalar* const __restrict upperPtr = matrix_.upper().begin();
+	const scalar* const __restrict lowerPtr = matrix_.lower().begin();
+
+	const label nCells = diag_.size();
+	for (label cell = 0; cell < nCells; cell++)
+	{
+		ApsiPtr[cell] = cmptMultiply(diagPtr[cell], psiPtr[cell]);
+	}
+
+	const label nFaces = matrix_.upper().size();
+	for (label face = 0; face < nFaces; face++)
+	{
+		ApsiPtr[uPtr[face]] += lowerPtr[face] * psiPtr[lPtr[face]];
+		ApsiPtr[lPtr[face]] += upperPtr[face] * psiPtr[uPtr[face]];
+	}
+
+	// Update the coupled interfaces component by component,
+	// exchanging only the values of the cells adjacent to the interfaces
+	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+	{
+		if (validComponents_[cmpt] == -1) continue;
+
+		forAll(interfaceCells_, i)
+		{
+			const label celli = interfaceCells_[i];
+			psiCmpt_[celli] = component(psiPtr[celli], cmpt);
+			resultCmpt_[celli] = component(ApsiPtr[celli], cmpt);
+		}
+
+		matrix_.initMatrixInterfaces
+		(
+			interfaceBouCoeffs_[cmpt],
+			interfaces_,
+			psiCmpt_,
+			resultCmpt_,
+			cmpt
+		);
+
+		matrix_.updateMatrixInterfaces
+		(
+			interfaceBouCoeffs_[cmpt],
+			interfaces_,
+			psiCmpt_,
+			resultCmpt_,
+			cmpt
+		);
+
+		forAll(interfaceCells_, i)
+		{
+			const label celli = interfaceCells_[i];
+			setComponent(ApsiPtr[celli], cmpt) = resultCmpt_[celli];
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::sumA(Field<Type>& sumA) const
+{
+	const Type one(pTraits<Type>::one);
+
+	Type* __restrict sumAPtr = sumA.begin();
+
+	const Type* const __restrict diagPtr = diag_.begin();
+
+	const label* const __restrict uPtr = matrix_.lduAddr().upperAddr().begin();
+	const label* const __restrict lPtr = matrix_.lduAddr().lowerAddr().begin();
+
+	const scalar* const __restrict upperPtr = matrix_.upper().begin();
+	const scalar* const __restrict lowerPtr = matrix_.lower().begin();
+
+	const label nCells = diag_.size();
+	for (label cell = 0; cell < nCells; cell++)
+	{
+		sumAPtr[cell] = diagPtr[cell];
+	}
+
+	const label nFaces = matrix_.upper().size();
+	for (label face = 0; face < nFaces; face++)
+	{
+		sumAPtr[uPtr[face]] += lowerPtr[face] * one;
+		sumAPtr[lPtr[face]] += upperPtr[face] * one;
+	}
+
+	// Add the interface boundary coefficients of each component
+	// to the sum-off-diagonal
+	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+	{
+		forAll(interfaces_, patchi)
+		{
+			if (interfaces_.set(patchi))
+			{
+				const labelUList& pa = matrix_.lduAddr().patchAddr(patchi);
+				const scalarField& pCoeffs = interfaceBouCoeffs_[cmpt][patchi];
+
+				forAll(pa, face)
+				{
+					setComponent(sumAPtr[pa[face]], cmpt) -= pCoeffs[face];
+				}
+			}
+		}
+	}
+}
+
+
+template<class Type>
+Type tnbLib::MultiComponentSolver<Type>::normFactor
+(
+	const Field<Type>& psi,
+	const Field<Type>& source,
+	const Field<Type>& Apsi,
+	Field<Type>& tmpField
+) const
+{
+	// --- Calculate A dot reference value of psi
+	sumA(tmpField);
+
+	const Type psiRef(gAverage(psi, matrix_.mesh().comm()));
+
+	forAll(tmpField, cell)
+	{
+		tmpField[cell] = cmptMultiply(tmpField[cell], psiRef);
+	}
+
+	return
+		gSum
+		(
+			(cmptMag(Apsi - tmpField) + cmptMag(source - tmpField))(),
+			matrix_.mesh().comm()
+		)
+		+ solverPerformance::small_*pTraits<Type>::one;
+}
+
+
+template<class Type>
+void tnbLib::MultiComponentSolver<Type>::precondition
+(
+	Field<Type>& wA,
+	const Field<Type>& rA
+) const
+{
+	Type* __restrict wAPtr = wA.begin();
+	const Type* __restrict rAPtr = rA.begin();
+	const Type* __restrict rDPtr = rD_.begin();
+
+	const label nCells = wA.size();
+
+	if (preconditionerName_ == "none")
+	{
+		for (label cell = 0; cell < nCells; cell++)
+		{
+			wAPtr[cell] = rAPtr[cell];
+		}
+
+		return;
+	}
+
+	for (label cell = 0; cell < nCells; cell++)
+	{
+		wAPtr[cell] = cmptMultiply(rDPtr[cell], rAPtr[cell]);
+	}
+
+	if (preconditionerName_ == "diagonal")
+	{
+		return;
+	}
+
+	const label* const __restrict uPtr = matrix_.lduAddr().upperAddr().begin();
+	const label* const __restrict lPtr = matrix_.lduAddr().lowerAddr().begin();
+	const label* const __restrict losortPtr =
+		matrix_.lduAddr().losortAddr().begin();
+
+	const scalar* const __restrict upperPtr = matrix_.upper().begin();
+	const scalar* const __restrict lowerPtr = matrix_.lower().begin();
+
+	const label nFaces = matrix_.upper().size();
+	const label nFacesM1 = nFaces - 1;
+
+	label sface;
+
+	for (label face = 0; face < nFaces; face++)
+	{
+		sface = losortPtr[face];
+		wAPtr[uPtr[sface]] -=
+			lowerPtr[sface]
+			* cmptMultiply(rDPtr[uPtr[sface]], wAPtr[lPtr[sface]]);
+	}
+
+	for (label face = nFacesM1; face >= 0; face--)
+	{
+		wAPtr[lPtr[face]] -=
+			upperPtr[face]
+			* cmptMultiply(rDPtr[lPtr[face]], wAPtr[uPtr[face]]);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::MultiComponentSolver<Type>::MultiComponentSolver
+(
+	const word& fieldName,
+	const lduMatrix& matrix,
+	const Field<Type>& diag,
+	const PtrList<FieldField<Field, scalar>>& interfaceBouCoeffs,
+	const lduInterfaceFieldPtrsList& interfaces,
+	const typename pTraits<Type>::labelType& validComponents,
+	const dictionary& solverControls
+)
+	:
+	fieldName_(fieldName),
+	matrix_(matrix),
+	diag_(diag),
+	interfaceBouCoeffs_(interfaceBouCoeffs),
+	interfaces_(interfaces),
+	validComponents_(validComponents),
+	controlDict_(solverControls),
+	maxIter_(1000),
+	minIter_(0),
+	tolerance_(1e-6),
+	relTol_(0),
+	preconditionerName_(lduMatrix::preconditioner::getName(solverControls)),
+	rD_(diag),
+	psiCmpt_(diag.size(), Zero),
+	resultCmpt_(diag.size(), Zero)
+{
+	readControls();
+	calcReciprocalD();
+	calcInterfaceCells();
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::List<tnbLib::solverPerformance>
+tnbLib::MultiComponentSolver<Type>::solve
+(
+	Field<Type>& psi,
+	const Field<Type>& source
+) const
+{
+	const label comm = matrix_.mesh().comm();
+
+	// --- Setup classes containing the solver performance data
+	//     and the list of components still being solved for
+	List<solverPerformance> solverPerfs(pTraits<Type>::nComponents);
+	boolList active(pTraits<Type>::nComponents);
+
+	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+	{
+		solverPerfs[cmpt] = solverPerformance
+		(
+			preconditionerName_ + "PBiCGStab",
+			fieldName_ + pTraits<Type>::componentNames[cmpt]
+		);
+
+		active[cmpt] = validComponents_[cmpt] != -1;
+	}
+
+	const label nCells = psi.size();
+
+	Type* __restrict psiPtr = psi.begin();
+
+	Field<Type> pA(nCells);
+	Type* __restrict pAPtr = pA.begin();
+
+	Field<Type> yA(nCells);
+	Type* __restrict yAPtr = yA.begin();
+
+	// --- Calculate A.psi
+	Amul(yA, psi);
+
+	// --- Calculate initial residual field
+	Field<Type> rA(source - yA);
+	Type* __restrict rAPtr = rA.begin();
+
+	// --- Calculate normalisation factor
+	const Type normFactor = this->normFactor(psi, source, yA, pA);
+
+	if (lduMatrix::debug >= 2)
+	{
+		Info << "   Normalisation factor = " << normFactor << endl;
+	}
+
+	// --- Calculate normalised residual norm
+	Type residual = cmptDivide(gSumCmptMag(rA, comm), normFactor);
+
+	// --- Check convergence
+	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+	{
+		if (!active[cmpt]) continue;
+
+		solverPerformance& solverPerf = solverPerfs[cmpt];
+
+		solverPerf.initialResidual() = component(residual, cmpt);
+		solverPerf.finalResidual() = solverPerf.initialResidual();
+
+		active[cmpt] =
+			minIter_ > 0
+			|| !solverPerf.checkConvergence(tolerance_, relTol_);
+	}
+
+	// --- Solve the components which are not converged
+	if (findIndex(active, true) != -1)
+	{
+		Field<Type> AyA(nCells);
+		Type* __restrict AyAPtr = AyA.begin();
+
+		Field<Type> sA(nCells);
+		Type* __restrict sAPtr = sA.begin();
+
+		Field<Type> zA(nCells);
+		Type* __restrict zAPtr = zA.begin();
+
+		Field<Type> tA(nCells);
+		Type* __restrict tAPtr = tA.begin();
+
+		// --- Store initial residual
+		const Field<Type> rA0(rA);
+
+		// --- Initial values not used
+		Type rA0rA = Zero;
+		Type alpha = Zero;
+		Type omega = Zero;
+
+		label nIter = 0;
+
+		// --- Solver iteration
+		do
+		{
+			// --- Store previous rA0rA
+			const Type rA0rAold = rA0rA;
+
+			rA0rA = gSumCmptProd(rA0, rA, comm);
+
+			// --- Test for singularity
+			for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+			{
+				if (!active[cmpt]) continue;
+
+				solverPerformance& solverPerf = solverPerfs[cmpt];
+
+				if
+					(
+						solverPerf.checkSingularity(mag(component(rA0rA, cmpt)))
+						|| (
+							nIter > 0
+							&& solverPerf.checkSingularity
+							(
+								mag(component(omega, cmpt))
+							)
+							)
+						)
+				{
+					active[cmpt] = false;
+				}
+			}
+
+			if (findIndex(active, true) == -1)
+			{
+				break;
+			}
+
+			// --- Update pA
+			if (nIter == 0)
+			{
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					pAPtr[cell] = rAPtr[cell];
+				}
+			}
+			else
+			{
+				Type beta = Zero;
+
+				for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+				{
+					if (!active[cmpt]) continue;
+
+					setComponent(beta, cmpt) =
+						(component(rA0rA, cmpt) / component(rA0rAold, cmpt))
+						* (component(alpha, cmpt) / component(omega, cmpt));
+				}
+
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					pAPtr[cell] =
+						rAPtr[cell]
+						+ cmptMultiply
+						(
+							beta,
+							pAPtr[cell] - cmptMultiply(omega, AyAPtr[cell])
+						);
+				}
+			}
+
+			// --- Precondition pA
+			precondition(yA, pA);
+
+			// --- Calculate AyA
+			Amul(AyA, yA);
+
+			const Type rA0AyA = gSumCmptProd(rA0, AyA, comm);
+
+			alpha = Zero;
+			for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+			{
+				if (!active[cmpt]) continue;
+
+				setComponent(alpha, cmpt) =
+					component(rA0rA, cmpt) / component(rA0AyA, cmpt);
+			}
+
+			// --- Calculate sA
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				sAPtr[cell] = rAPtr[cell] - cmptMultiply(alpha, AyAPtr[cell]);
+			}
+
+			// --- Test sA for convergence
+			residual = cmptDivide(gSumCmptMag(sA, comm), normFactor);
+
+			Type alphaConverged = Zero;
+			bool converged = false;
+
+			for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+			{
+				if (!active[cmpt]) continue;
+
+				solverPerformance& solverPerf = solverPerfs[cmpt];
+
+				solverPerf.finalResidual() = component(residual, cmpt);
+
+				if (solverPerf.checkConvergence(tolerance_, relTol_))
+				{
+					setComponent(alphaConverged, cmpt) = component(alpha, cmpt);
+					setComponent(alpha, cmpt) = 0;
+
+					solverPerf.nIterations()++;
+					active[cmpt] = false;
+					converged = true;
+				}
+			}
+
+			if (converged)
+			{
+				for (label cell = 0; cell < nCells; cell++)
+				{
+					psiPtr[cell] += cmptMultiply(alphaConverged, yAPtr[cell]);
+				}
+			}
+
+			if (findIndex(active, true) == -1)
+			{
+				break;
+			}
+
+			// --- Precondition sA
+			precondition(zA, sA);
+
+			// --- Calculate tA
+			Amul(tA, zA);
+
+			const Type tAtA = gSumCmptProd(tA, tA, comm);
+
+			// --- Calculate omega from tA and sA
+			//     (cheaper than using zA with preconditioned tA)
+			const Type tAsA = gSumCmptProd(tA, sA, comm);
+
+			omega = Zero;
+			for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+			{
+				if (!active[cmpt]) continue;
+
+				setComponent(omega, cmpt) =
+					component(tAsA, cmpt) / component(tAtA, cmpt);
+			}
+
+			// --- Update solution and residual
+			for (label cell = 0; cell < nCells; cell++)
+			{
+				psiPtr[cell] +=
+					cmptMultiply(alpha, yAPtr[cell])
+					+ cmptMultiply(omega, zAPtr[cell]);
+
+				rAPtr[cell] = sAPtr[cell] - cmptMultiply(omega, tAPtr[cell]);
+			}
+
+			residual = cmptDivide(gSumCmptMag(rA, comm), normFactor);
+
+			nIter++;
+
+			for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
+			{
+				if (!active[cmpt]) continue;
+
+				solverPerformance& solverPerf = solverPerfs[cmpt];
+
+				solverPerf.finalResidual() = component(residual, cmpt);
+
+				active[cmpt] =
+					(
+						++solverPerf.nIterations() < maxIter_
+						&& !solverPerf.checkConvergence(tolerance_, relTol_)
+						)
+					|| solverPerf.nIterations() < minIter_;
+			}
+		} while (findIndex(active, true) != -1);
+	}
+
+	return solverPerfs;
+}
+
+
+// ************************************************************************* //
@@ -44,6 +44,12 @@ Description
 	collecting is done locally; the thread only does the writing
 	(since the data has already been collected)
 
+	Formatted data can also be queued as a snapshot with writeSnapshot().
+	The thread then does both the collecting and the writing, so that the
+	caller only pays for the formatting. The snapshots are held on all
+	processors until written; waitSnapshots() waits for them on all
+	processors.
+
 
 Operation determine
 
@@ -91,6 +97,10 @@ namespace tnbLib
 			const IOstream::compressionType compression_;
 			const bool append_;
 
+			//- Whether the thread collects the sizes of the data, as for
+			//  a snapshot
+			const bool gather_;
+
 			writeData
 			(
 				const label comm,
@@ -113,7 +123,31 @@ namespace tnbLib
 				format_(format),
 				version_(version),
 				compression_(compression),
-				append_(append)
+				append_(append),
+				gather_(false)
+			{}
+
+			writeData
+			(
+				const label comm,
+				const fileName& pathName,
+				const string& data,
+				IOstream::streamFormat format,
+				IOstream::versionNumber version,
+				IOstream::compressionType compression
+			)
+				:
+				comm_(comm),
+				typeName_(word::null),
+				pathName_(pathName),
+				data_(data),
+				sizes_(0),
+				slaveData_(0),
+				format_(format),
+				version_(version),
+				compression_(compression),
+				append_(false),
+				gather_(true)
 			{}
 
 			//- (approximate) size of master + any optional slave data
@@ -171,9 +205,16 @@ namespace tnbLib
 			const bool append
 		);
 
+		//- Collect and write a snapshot. Called in the write thread
+		static FoamBase_EXPORT bool writeSnapshotFile(writeData& object);
+
 		//- Write all files in stack
 		static FoamBase_EXPORT void* writeAll(void *threadarg);
 
+		//- Push an object onto the stack and start the thread if it is not
+		//  running. The mutex must be locked by the caller
+		FoamBase_EXPORT void push(writeData* objectPtr);
+
 		//- Wait for total size of objects_ (master + optional slave data)
 		//  to be wantedSize less than overall maxBufferSize.
 		FoamBase_EXPORT void waitForBufferSpace(const off_t wantedSize) const;
@@ -219,8 +260,23 @@ namespace tnbLib
 			const bool useThread = true
 		);
 
+		//- Queue formatted data to be collected and written by the thread.
+		//  Requires thread support in MPI and the same sequence of calls on
+		//  all processors
+		FoamBase_EXPORT void writeSnapshot
+		(
+			const string& data,
+			const fileName&,
+			IOstream::streamFormat,
+			IOstream::versionNumber,
+			IOstream::compressionType
+		);
+
 		//- Wait for all thread actions to have finished
 		FoamBase_EXPORT void waitAll();
+
+		//- Wait on all processors for all thread actions to have finished
+		FoamBase_EXPORT void waitSnapshots();
 	};
 
 
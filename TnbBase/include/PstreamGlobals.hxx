@@ -66,7 +66,46 @@ namespace tnbLib
 
 		FoamBase_EXPORT extern DynamicList<MPI_Group> MPIGroups_;
 
+		// Neighbourhood (distributed graph) communicators
+		FoamBase_EXPORT extern DynamicList<MPI_Comm> MPINeighbourCommunicators_;
+
 		FoamBase_EXPORT void checkCommunicator(const label, const label procNo);
+
+
+		//- Persistent request and the transfer it was created for
+		class persistentChannel
+		{
+		public:
+
+			MPI_Request request;
+			bool send;
+			int procNo;
+			const char* buf;
+			std::streamsize bufSize;
+			int tag;
+			label comm;
+		};
+
+		// Persistent send and receive channels
+		FoamBase_EXPORT extern DynamicList<persistentChannel>
+			persistentChannels_;
+
+		//- Start the transfer on the given persistent channel, creating or
+		//  re-creating the channel if the transfer differs from the one it
+		//  was created for. The request is appended to outstandingRequests_
+		FoamBase_EXPORT void startPersistentChannel
+		(
+			label& channel,
+			const bool send,
+			const int procNo,
+			const char* buf,
+			const std::streamsize bufSize,
+			const int tag,
+			const label comm
+		);
+
+		//- Free the given persistent channel and set it to -1
+		FoamBase_EXPORT void freePersistentChannel(label& channel);
 	};
 
 
@@ -0,0 +1,43 @@
+#pragma once
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class Type>
+inline tnbLib::SoAField<Type>::SoAField()
+{}
+
+
+template<class Type>
+inline tnbLib::SoAField<Type>::SoAField(const label size)
+{
+	forAll(components_, d)
+	{
+		components_[d].setSize(size);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+inline tnbLib::label tnbLib::SoAField<Type>::size() const
+{
+	return components_[0].size();
+}
+
+
+template<class Type>
+inline const tnbLib::scalarField&
+tnbLib::SoAField<Type>::component(const direction d) const
+{
+	return components_[d];
+}
+
+
+template<class Type>
+inline tnbLib::scalarField& tnbLib::SoAField<Type>::component(const direction d)
+{
+	return components_[d];
+}
+
+
+// ************************************************************************* //
@@ -1,5 +1,6 @@
 #pragma once
 #include <IOstreams.hxx>
+#include <taskParallel.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -73,6 +74,9 @@ void tnbLib::SolverPerformance<Type>::print
 	Ostream& os
 ) const
 {
+	// Keep the lines of concurrently solved equations together
+	taskParallel::sharedLock lock;
+
 	for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; cmpt++)
 	{
 		if (pTraits<Type>::nComponents == 1)
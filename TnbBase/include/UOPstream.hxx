@@ -138,6 +138,36 @@ namespace tnbLib
 			const label communicator = 0
 		);
 
+		//- Start a non-blocking write of the given buffer to the given
+		//  processor on a persistent channel, set to -1 initially. The
+		//  channel is created on the first write and re-created if the
+		//  buffer, its size or the destination change. Falls back to a
+		//  non-blocking write unless UPstream::persistentRequests is set.
+		static FoamBase_EXPORT bool write
+		(
+			label& channel,
+			const int toProcNo,
+			const char* buf,
+			const std::streamsize bufSize,
+			const int tag = UPstream::msgType(),
+			const label communicator = 0
+		);
+
+		//- Copy the given buffer into the shared-memory window of the node
+		//  for the given processor. Returns false if the processor is not a
+		//  UPstream::sharedMemoryPeer or if the message has to be sent by
+		//  MPI, e.g. if there is no space for it because earlier messages
+		//  have not been read yet, in which case nothing is sent. The
+		//  message must be read with UIPstream::readShared
+		static FoamBase_EXPORT bool writeShared
+		(
+			const int toProcNo,
+			const char* buf,
+			const std::streamsize bufSize,
+			const int tag = UPstream::msgType(),
+			const label communicator = 0
+		);
+
 		//- Write next token to stream
 		FoamBase_EXPORT Ostream& write(const token&);
 
@@ -285,6 +285,16 @@ namespace tnbLib
 		//- Number of polling cycles in processor updates
 		static FoamBase_EXPORT int nPollProcInterfaces;
 
+		//- Should repeated non-blocking processor interface transfers use
+		//  persistent requests, see UOPstream::write and UIPstream::read
+		//  taking a channel
+		static FoamBase_EXPORT bool persistentRequests;
+
+		//- Size in bytes of the segment of each rank in the shared-memory
+		//  window used for processor interface transfers between ranks on
+		//  the same node. 0 disables the shared-memory transfers
+		static FoamBase_EXPORT int sharedMemoryBufferSize;
+
 		//- Default communicator (all processors)
 		static FoamBase_EXPORT label worldComm;
 
@@ -321,6 +331,22 @@ namespace tnbLib
 		//- Free all communicators
 		static FoamBase_EXPORT void freeCommunicators(const bool doPstream);
 
+		//- Allocate a neighbourhood communicator connecting this processor
+		//  symmetrically to the given neighbour processors of the
+		//  communicator, for use with neighbourAllToAll. Collective over the
+		//  communicator. Returns -1 if not running in parallel.
+		static FoamBase_EXPORT label allocateNeighbourCommunicator
+		(
+			const labelUList& neighbourProcs,
+			const label communicator = 0
+		);
+
+		//- Free a previously allocated neighbourhood communicator
+		static FoamBase_EXPORT void freeNeighbourCommunicator
+		(
+			const label neighbourCommunicator
+		);
+
 		//- Helper class for allocating/freeing communicators
 		class communicator
 		{
@@ -397,6 +423,20 @@ namespace tnbLib
 		//- Non-blocking comms: has request i finished?
 		static FoamBase_EXPORT bool finishedRequest(const label i);
 
+		//- Free a persistent channel, waiting for its transfer to finish.
+		//  Sets the channel to -1
+		static FoamBase_EXPORT void freeChannel(label& channel);
+
+		//- Return true if transfers to and from the given processor go
+		//  through the shared-memory window of the node, see
+		//  UOPstream::writeShared and UIPstream::readShared
+		static FoamBase_EXPORT bool sharedMemoryPeer
+		(
+			const int procNo,
+			const label communicator = 0
+		);
+
+
 		static FoamBase_EXPORT int allocateTag(const char*);
 
 		static FoamBase_EXPORT int allocateTag(const word&);
@@ -538,6 +578,23 @@ namespace tnbLib
 			const label communicator = 0
 		);
 
+		//- Exchange data with the neighbours of a neighbourhood communicator
+		//  in a single collective. The sizes and offsets are given per
+		//  neighbour in the order the neighbours were given to
+		//  allocateNeighbourCommunicator.
+		static FoamBase_EXPORT void neighbourAllToAll
+		(
+			const char* sendData,
+			const UList<int>& sendSizes,
+			const UList<int>& sendOffsets,
+
+			char* recvData,
+			const UList<int>& recvSizes,
+			const UList<int>& recvOffsets,
+
+			const label neighbourCommunicator
+		);
+
 		//- Receive data from all processors on the master
 		static FoamBase_EXPORT void gather
 		(
@@ -0,0 +1,135 @@
+#pragma once
+#ifndef _lduCSRAddressing_Header
+#define _lduCSRAddressing_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::lduCSRAddressing
+
+Description
+	Compressed sparse row (CSR) addressing equivalent to a given
+	lduAddressing.
+
+	The coefficients of each row are stored contiguously in ascending column
+	order: the lower-triangle coefficients, the diagonal and the
+	upper-triangle coefficients. For each coefficient the index into the
+	LDU coefficients is stored, numbered as the diagonal coefficients
+	followed by the upper and then the lower coefficients, so that the CSR
+	coefficients of an lduMatrix can be gathered in a single pass.
+
+	The addressing only depends on the mesh topology and is cached by
+	lduAddressing.
+
+SourceFiles
+	lduCSRAddressing.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <labelList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class lduAddressing;
+
+	/*---------------------------------------------------------------------------*\
+							   Class lduCSRAddressing Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class lduCSRAddressing
+	{
+		// Private Data
+
+			//- Start of the coefficients of each row. Size is nRows + 1.
+		labelList rowStart_;
+
+		//- Column of each coefficient
+		labelList column_;
+
+		//- Index of each coefficient into the LDU coefficients
+		labelList lduCoeff_;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from LDU addressing
+		FoamBase_EXPORT lduCSRAddressing(const lduAddressing&);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT lduCSRAddressing(const lduCSRAddressing&) = delete;
+
+
+		// Member Functions
+
+			//- Return the number of rows
+		label size() const
+		{
+			return rowStart_.size() - 1;
+		}
+
+		//- Return the number of coefficients
+		label nCoeffs() const
+		{
+			return column_.size();
+		}
+
+		//- Return the start of the coefficients of each row
+		const labelList& rowStart() const
+		{
+			return rowStart_;
+		}
+
+		//- Return the column of each coefficient
+		const labelList& column() const
+		{
+			return column_;
+		}
+
+		//- Return the index of each coefficient into the LDU coefficients
+		const labelList& lduCoeff() const
+		{
+			return lduCoeff_;
+		}
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const lduCSRAddressing&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_lduCSRAddressing_Header
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef _lduCSRMatrix_Header
+#define _lduCSRMatrix_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::lduCSRMatrix
+
+Description
+	Copy of the internal coefficients of an lduMatrix in compressed sparse
+	row (CSR) format.
+
+	The row-wise storage gives contiguous coefficient access and a single
+	write per row for the matrix-vector product and the residual, which
+	are evaluated by the threadPool over the thread blocks of the
+	lduAddressing. The interface coefficients are not included and are
+	handled by lduMatrix as for the LDU format.
+
+	Constructed by lduMatrix::csr() when the "matrixFormat CSR" solver
+	control is selected; the addressing is shared through
+	lduAddressing::csrAddr().
+
+SourceFiles
+	lduCSRMatrix.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <lduCSRAddressing.hxx>
+#include <scalarField.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class lduMatrix;
+
+	/*---------------------------------------------------------------------------*\
+							   Class lduCSRMatrix Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class lduCSRMatrix
+	{
+		// Private Data
+
+			//- LDU addressing, providing the thread blocks
+		const lduAddressing& lduAddr_;
+
+		//- CSR addressing
+		const lduCSRAddressing& addr_;
+
+		//- Coefficients in CSR order
+		scalarField coeffs_;
+
+
+	public:
+
+		// Constructors
+
+			//- Construct from the coefficients of the given lduMatrix
+		FoamBase_EXPORT explicit lduCSRMatrix(const lduMatrix&);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT lduCSRMatrix(const lduCSRMatrix&) = delete;
+
+
+		// Member Functions
+
+			// Access
+
+				//- Return the CSR addressing
+		const lduCSRAddressing& addr() const
+		{
+			return addr_;
+		}
+
+		//- Return the coefficients in CSR order
+		const scalarField& coeffs() const
+		{
+			return coeffs_;
+		}
+
+
+		// Operations
+
+			//- Matrix multiplication of the internal coefficients
+		FoamBase_EXPORT void Amul(scalarField& Apsi, const scalarField& psi) const;
+
+		//- Sum the internal coefficients of each row
+		FoamBase_EXPORT void sumA(scalarField& sumA) const;
+
+		//- Residual of the internal coefficients
+		FoamBase_EXPORT void residual
+		(
+			scalarField& rA,
+			const scalarField& psi,
+			const scalarField& source
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const lduCSRMatrix&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_lduCSRMatrix_Header
@@ -81,6 +81,7 @@ namespace tnbLib
 	public:
 
 		friend class LUscalarMatrix;
+		friend class LDLTscalarMatrix;
 
 
 		// Constructors
@@ -80,6 +80,12 @@ namespace tnbLib
 		//- Scalar receive buffer
 		mutable Field<scalar> scalarReceiveBuf_;
 
+		//- Persistent channel of the scalar send buffer
+		mutable label scalarSendChannel_;
+
+		//- Persistent channel of the scalar receive buffer
+		mutable label scalarReceiveChannel_;
+
 
 	public:
 
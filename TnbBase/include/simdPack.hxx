@@ -0,0 +1,160 @@
+#pragma once
+#ifndef _simdPack_Header
+#define _simdPack_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::simdPack
+
+Description
+	Portable pack of two scalars used by the explicitly vectorised field
+	kernels.
+
+	If the scalar type is double and SSE2 is available (always the case on
+	x86-64) the pack maps onto an __m128d register, otherwise a scalar
+	implementation with the same interface is used so that the kernels
+	compile, and give the same results, on any platform.
+
+	Only the operations required to transpose small array-of-structures
+	blocks into component packs and back are provided, see deinterleave
+	and interleave.
+
+SourceFiles
+	simdPackI.H
+
+\*---------------------------------------------------------------------------*/
+
+#include <scalar.hxx>
+#include <direction.hxx>
+
+#if defined(WM_DP) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define simdPack_SSE2
+	#include <emmintrin.h>
+#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class simdPack Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class simdPack
+	{
+		// Private Data
+
+#ifdef simdPack_SSE2
+			__m128d v_;
+
+		//- Construct from a register
+		inline simdPack(const __m128d v);
+#else
+			scalar v_[2];
+#endif
+
+
+	public:
+
+		// Static Data
+
+			//- Number of scalars in the pack
+		static const direction size = 2;
+
+
+		// Constructors
+
+			//- Construct null (uninitialised)
+		inline simdPack();
+
+		//- Construct with both elements set to s
+		inline explicit simdPack(const scalar s);
+
+		//- Construct from two elements
+		inline simdPack(const scalar s0, const scalar s1);
+
+
+		// Static Member Functions
+
+			//- Load two consecutive scalars, no alignment required
+		static inline simdPack load(const scalar* p);
+
+		//- Return (a[0], b[0])
+		static inline simdPack unpackLo(const simdPack& a, const simdPack& b);
+
+		//- Return (a[1], b[1])
+		static inline simdPack unpackHi(const simdPack& a, const simdPack& b);
+
+		//- Transpose the N components of two consecutive elements
+		//  starting at p into N packs of (element0, element1)
+		template<direction N>
+		static inline void deinterleave(const scalar* p, simdPack* c);
+
+		//- Inverse of deinterleave
+		template<direction N>
+		static inline void interleave(const simdPack* c, scalar* p);
+
+
+		// Member Functions
+
+			//- Store both elements to p, no alignment required
+		inline void store(scalar* p) const;
+
+		//- Return the element i
+		inline scalar operator[](const direction i) const;
+
+		//- Return the sum of the elements
+		inline scalar sum() const;
+
+
+		// Member Operators
+
+		inline void operator+=(const simdPack& b);
+		inline void operator-=(const simdPack& b);
+		inline void operator*=(const simdPack& b);
+	};
+
+
+	// Global Operators
+
+	inline simdPack operator+(const simdPack& a, const simdPack& b);
+	inline simdPack operator-(const simdPack& a, const simdPack& b);
+	inline simdPack operator*(const simdPack& a, const simdPack& b);
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <simdPackI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_simdPack_Header
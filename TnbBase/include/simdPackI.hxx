@@ -0,0 +1,227 @@
+#pragma once
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+#ifdef simdPack_SSE2
+
+inline tnbLib::simdPack::simdPack(const __m128d v)
+	:
+	v_(v)
+{}
+
+
+inline tnbLib::simdPack::simdPack()
+{}
+
+
+inline tnbLib::simdPack::simdPack(const scalar s)
+	:
+	v_(_mm_set1_pd(s))
+{}
+
+
+inline tnbLib::simdPack::simdPack(const scalar s0, const scalar s1)
+	:
+	v_(_mm_set_pd(s1, s0))
+{}
+
+#else
+
+inline tnbLib::simdPack::simdPack()
+{}
+
+
+inline tnbLib::simdPack::simdPack(const scalar s)
+{
+	v_[0] = s;
+	v_[1] = s;
+}
+
+
+inline tnbLib::simdPack::simdPack(const scalar s0, const scalar s1)
+{
+	v_[0] = s0;
+	v_[1] = s1;
+}
+
+#endif
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+inline tnbLib::simdPack tnbLib::simdPack::load(const scalar* p)
+{
+#ifdef simdPack_SSE2
+	return simdPack(_mm_loadu_pd(p));
+#else
+	return simdPack(p[0], p[1]);
+#endif
+}
+
+
+inline tnbLib::simdPack tnbLib::simdPack::unpackLo
+(
+	const simdPack& a,
+	const simdPack& b
+)
+{
+#ifdef simdPack_SSE2
+	return simdPack(_mm_unpacklo_pd(a.v_, b.v_));
+#else
+	return simdPack(a.v_[0], b.v_[0]);
+#endif
+}
+
+
+inline tnbLib::simdPack tnbLib::simdPack::unpackHi
+(
+	const simdPack& a,
+	const simdPack& b
+)
+{
+#ifdef simdPack_SSE2
+	return simdPack(_mm_unpackhi_pd(a.v_, b.v_));
+#else
+	return simdPack(a.v_[1], b.v_[1]);
+#endif
+}
+
+
+template<tnbLib::direction N>
+inline void tnbLib::simdPack::deinterleave(const scalar* p, simdPack* c)
+{
+	// Pairs of components are loaded from each element and transposed
+	for (direction i = 0; i + 1 < N; i += 2)
+	{
+		const simdPack a(load(p + i));
+		const simdPack b(load(p + N + i));
+		c[i] = unpackLo(a, b);
+		c[i + 1] = unpackHi(a, b);
+	}
+
+	// The last component of an odd-sized element is gathered
+	if (N % 2)
+	{
+		c[N - 1] = simdPack(p[N - 1], p[2 * N - 1]);
+	}
+}
+
+
+template<tnbLib::direction N>
+inline void tnbLib::simdPack::interleave(const simdPack* c, scalar* p)
+{
+	for (direction i = 0; i + 1 < N; i += 2)
+	{
+		unpackLo(c[i], c[i + 1]).store(p + i);
+		unpackHi(c[i], c[i + 1]).store(p + N + i);
+	}
+
+	if (N % 2)
+	{
+		p[N - 1] = c[N - 1][0];
+		p[2 * N - 1] = c[N - 1][1];
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+inline void tnbLib::simdPack::store(scalar* p) const
+{
+#ifdef simdPack_SSE2
+	_mm_storeu_pd(p, v_);
+#else
+	p[0] = v_[0];
+	p[1] = v_[1];
+#endif
+}
+
+
+inline tnbLib::scalar tnbLib::simdPack::operator[](const direction i) const
+{
+#ifdef simdPack_SSE2
+	return i ? _mm_cvtsd_f64(_mm_unpackhi_pd(v_, v_)) : _mm_cvtsd_f64(v_);
+#else
+	return v_[i];
+#endif
+}
+
+
+inline tnbLib::scalar tnbLib::simdPack::sum() const
+{
+	return operator[](0) + operator[](1);
+}
+
+
+// * * * * * * * * * * * * * * * Member Operators  * * * * * * * * * * * * * //
+
+#ifdef simdPack_SSE2
+
+inline void tnbLib::simdPack::operator+=(const simdPack& b)
+{
+	v_ = _mm_add_pd(v_, b.v_);
+}
+
+
+inline void tnbLib::simdPack::operator-=(const simdPack& b)
+{
+	v_ = _mm_sub_pd(v_, b.v_);
+}
+
+
+inline void tnbLib::simdPack::operator*=(const simdPack& b)
+{
+	v_ = _mm_mul_pd(v_, b.v_);
+}
+
+#else
+
+inline void tnbLib::simdPack::operator+=(const simdPack& b)
+{
+	v_[0] += b.v_[0];
+	v_[1] += b.v_[1];
+}
+
+
+inline void tnbLib::simdPack::operator-=(const simdPack& b)
+{
+	v_[0] -= b.v_[0];
+	v_[1] -= b.v_[1];
+}
+
+
+inline void tnbLib::simdPack::operator*=(const simdPack& b)
+{
+	v_[0] *= b.v_[0];
+	v_[1] *= b.v_[1];
+}
+
+#endif
+
+
+// * * * * * * * * * * * * * * * Global Operators  * * * * * * * * * * * * * //
+
+inline tnbLib::simdPack tnbLib::operator+(const simdPack& a, const simdPack& b)
+{
+	simdPack r(a);
+	r += b;
+	return r;
+}
+
+
+inline tnbLib::simdPack tnbLib::operator-(const simdPack& a, const simdPack& b)
+{
+	simdPack r(a);
+	r -= b;
+	return r;
+}
+
+
+inline tnbLib::simdPack tnbLib::operator*(const simdPack& a, const simdPack& b)
+{
+	simdPack r(a);
+	r *= b;
+	return r;
+}
+
+
+// ************************************************************************* //
@@ -26,6 +26,7 @@ namespace tnbLib
 			(
 				commsType == Pstream::commsTypes::nonBlocking
 				&& !Pstream::floatTransfer
+				&& !procPatch_.sharedMemory()
 				)
 		{
 			// Fast path.
@@ -42,7 +43,7 @@ namespace tnbLib
 			outstandingRecvRequest_ = UPstream::nRequests();
 			UIPstream::read
 			(
-				Pstream::commsTypes::nonBlocking,
+				scalarReceiveChannel_,
 				procPatch_.neighbProcNo(),
 				reinterpret_cast<char*>(scalarReceiveBuf_.begin()),
 				scalarReceiveBuf_.byteSize(),
@@ -53,7 +54,7 @@ namespace tnbLib
 			outstandingSendRequest_ = UPstream::nRequests();
 			UOPstream::write
 			(
-				Pstream::commsTypes::nonBlocking,
+				scalarSendChannel_,
 				procPatch_.neighbProcNo(),
 				reinterpret_cast<const char*>(scalarSendBuf_.begin()),
 				scalarSendBuf_.byteSize(),
@@ -91,6 +92,7 @@ namespace tnbLib
 			(
 				commsType == Pstream::commsTypes::nonBlocking
 				&& !Pstream::floatTransfer
+				&& !procPatch_.sharedMemory()
 				)
 		{
 			// Fast path.
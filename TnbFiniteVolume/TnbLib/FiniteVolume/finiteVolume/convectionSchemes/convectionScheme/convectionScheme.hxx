@@ -297,6 +297,16 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>&
 			) const = 0;
 
+			//- Add coeff*fvmDiv(faceFlux, vf) to the given matrix in place.
+			//  The default implementation assembles the term separately
+			virtual void addFvmDiv
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const surfaceScalarField&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			) const;
+
 			virtual tmp<GeometricField<Type, fvPatchField, volMesh>> fvcDiv
 			(
 				const surfaceScalarField&,
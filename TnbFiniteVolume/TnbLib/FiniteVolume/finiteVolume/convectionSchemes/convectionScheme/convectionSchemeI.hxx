@@ -125,6 +125,28 @@ namespace tnbLib
 		{}
 
 
+		// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+		template<class Type>
+		void convectionScheme<Type>::addFvmDiv
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const surfaceScalarField& faceFlux,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		) const
+		{
+			tmp<fvMatrix<Type>> tdiv(fvmDiv(faceFlux, vf));
+
+			if (coeff != 1)
+			{
+				tdiv.ref() *= dimensionedScalar(dimless, coeff);
+			}
+
+			fvm += tdiv;
+		}
+
+
 		// * * * * * * * * * * * * * * * Member Operators  * * * * * * * * * * * * * //
 
 		template<class Type>
@@ -90,6 +90,65 @@ namespace tnbLib
 		}
 
 
+		template<class Type>
+		void gaussConvectionScheme<Type>::addFvmDiv
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const surfaceScalarField& faceFlux,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		) const
+		{
+			tmp<surfaceScalarField> tweights = tinterpScheme_().weights(vf);
+			const surfaceScalarField& weights = tweights();
+
+			const labelUList& l = fvm.lduAddr().lowerAddr();
+			const labelUList& u = fvm.lduAddr().upperAddr();
+
+			const scalarField& w = weights.primitiveField();
+			const scalarField& F = faceFlux.primitiveField();
+
+			// Obtain lower before upper so that a symmetric matrix is
+			// converted to an asymmetric one by copying its upper coefficients
+			scalarField& lower = fvm.lower();
+			scalarField& upper = fvm.upper();
+			scalarField& diag = fvm.diag();
+
+			forAll(lower, facei)
+			{
+				const scalar lowerCoeff = -coeff * w[facei] * F[facei];
+				const scalar upperCoeff = lowerCoeff + coeff * F[facei];
+
+				lower[facei] += lowerCoeff;
+				upper[facei] += upperCoeff;
+				diag[l[facei]] -= lowerCoeff;
+				diag[u[facei]] -= upperCoeff;
+			}
+
+			forAll(vf.boundaryField(), patchi)
+			{
+				const fvPatchField<Type>& psf = vf.boundaryField()[patchi];
+				const fvsPatchScalarField& patchFlux = faceFlux.boundaryField()[patchi];
+				const fvsPatchScalarField& pw = weights.boundaryField()[patchi];
+
+				fvm.internalCoeffs()[patchi] +=
+					coeff * patchFlux * psf.valueInternalCoeffs(pw);
+				fvm.boundaryCoeffs()[patchi] -=
+					coeff * patchFlux * psf.valueBoundaryCoeffs(pw);
+			}
+
+			if (tinterpScheme_().corrected())
+			{
+				fvm +=
+					coeff
+					* fvc::surfaceIntegrate
+					(
+						faceFlux*tinterpScheme_().correction(vf)
+					);
+			}
+		}
+
+
 		template<class Type>
 		tmp<GeometricField<Type, fvPatchField, volMesh>>
 			gaussConvectionScheme<Type>::fvcDiv
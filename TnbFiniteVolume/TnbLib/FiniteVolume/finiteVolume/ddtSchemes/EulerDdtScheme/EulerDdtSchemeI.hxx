@@ -475,6 +475,70 @@ namespace tnbLib
 		}
 
 
+		template<class Type>
+		void EulerDdtScheme<Type>::addFvmDdt
+		(
+			fvMatrix<Type>& fvm,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			const scalar rDeltaT = 1.0 / mesh().time().deltaTValue();
+
+			const tmp<DimensionedField<scalar, volMesh>> tVsc(mesh().Vsc());
+			const tmp<DimensionedField<scalar, volMesh>> tVsc0
+			(
+				mesh().moving() ? mesh().Vsc0() : tVsc
+			);
+			const scalarField& Vsc = tVsc();
+			const scalarField& Vsc0 = tVsc0();
+
+			const Field<Type>& vf0 = vf.oldTime().primitiveField();
+
+			scalarField& diag = fvm.diag();
+			Field<Type>& source = fvm.source();
+
+			forAll(diag, celli)
+			{
+				diag[celli] += rDeltaT * Vsc[celli];
+				source[celli] += rDeltaT * vf0[celli] * Vsc0[celli];
+			}
+		}
+
+
+		template<class Type>
+		void EulerDdtScheme<Type>::addFvmDdt
+		(
+			fvMatrix<Type>& fvm,
+			const volScalarField& rho,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			const scalar rDeltaT = 1.0 / mesh().time().deltaTValue();
+
+			const tmp<DimensionedField<scalar, volMesh>> tVsc(mesh().Vsc());
+			const tmp<DimensionedField<scalar, volMesh>> tVsc0
+			(
+				mesh().moving() ? mesh().Vsc0() : tVsc
+			);
+			const scalarField& Vsc = tVsc();
+			const scalarField& Vsc0 = tVsc0();
+
+			const scalarField& rhoi = rho.primitiveField();
+			const scalarField& rho0 = rho.oldTime().primitiveField();
+			const Field<Type>& vf0 = vf.oldTime().primitiveField();
+
+			scalarField& diag = fvm.diag();
+			Field<Type>& source = fvm.source();
+
+			forAll(diag, celli)
+			{
+				diag[celli] += rDeltaT * rhoi[celli] * Vsc[celli];
+				source[celli] +=
+					rDeltaT * rho0[celli] * vf0[celli] * Vsc0[celli];
+			}
+		}
+
+
 		template<class Type>
 		tmp<typename EulerDdtScheme<Type>::fluxFieldType>
 			EulerDdtScheme<Type>::fvcDdtUfCorr
@@ -29,7 +29,8 @@ InNamespace
 	tnbLib::fvm
 
 Description
-	Calculate the matrix for the divergence of the given field and flux.
+	Calculate the matrix for the divergence of the given field and flux
+	or add it in place to an existing matrix.
 
 SourceFiles
 	fvmDiv.C
@@ -82,6 +83,28 @@ namespace tnbLib
 			const tmp<surfaceScalarField>&,
 			const GeometricField<Type, fvPatchField, volMesh>&
 		);
+
+
+		// In-place assembly
+
+		//- Add div(flux, vf) to the given matrix
+		template<class Type>
+		void addDiv
+		(
+			fvMatrix<Type>&,
+			const surfaceScalarField&,
+			const GeometricField<Type, fvPatchField, volMesh>&,
+			const word& name
+		);
+
+		//- Add div(flux, vf) to the given matrix
+		template<class Type>
+		void addDiv
+		(
+			fvMatrix<Type>&,
+			const surfaceScalarField&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
 	}
 
 
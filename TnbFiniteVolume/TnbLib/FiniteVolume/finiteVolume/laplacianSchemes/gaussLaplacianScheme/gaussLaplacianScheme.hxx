@@ -132,6 +132,17 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>&
 			);
 
+			//- Add coeff times the uncorrected Laplacian directly to the
+			//  coefficients of the given matrix
+			static void addFvmLaplacianUncorrected
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const surfaceScalarField& gammaMagSf,
+				const surfaceScalarField& deltaCoeffs,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
 			tmp<GeometricField<Type, fvPatchField, volMesh>> fvcLaplacian
 			(
 				const GeometricField<Type, fvPatchField, volMesh>&
@@ -143,6 +154,14 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>&
 			);
 
+			void addFvmLaplacian
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const GeometricField<GType, fvsPatchField, surfaceMesh>&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
 			tmp<GeometricField<Type, fvPatchField, volMesh>> fvcLaplacian
 			(
 				const GeometricField<GType, fvsPatchField, surfaceMesh>&,
@@ -164,6 +183,15 @@ tmp<fvMatrix<Type>> gaussLaplacianScheme<Type, scalar>::fvmLaplacian           \
 );                                                                             \
                                                                                \
 template<>                                                                     \
+void gaussLaplacianScheme<Type, scalar>::addFvmLaplacian                       \
+(                                                                              \
+    fvMatrix<Type>&,                                                           \
+    const scalar,                                                              \
+    const GeometricField<scalar, fvsPatchField, surfaceMesh>&,                 \
+    const GeometricField<Type, fvPatchField, volMesh>&                         \
+);                                                                             \
+                                                                               \
+template<>                                                                     \
 tmp<GeometricField<Type, fvPatchField, volMesh>>                               \
 gaussLaplacianScheme<Type, scalar>::fvcLaplacian                               \
 (                                                                              \
@@ -63,6 +63,72 @@ namespace tnbLib
 		}
 
 
+		template<class Type, class GType>
+		void gaussLaplacianScheme<Type, GType>::addFvmLaplacianUncorrected
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const surfaceScalarField& gammaMagSf,
+			const surfaceScalarField& deltaCoeffs,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			const labelUList& l = fvm.lduAddr().lowerAddr();
+			const labelUList& u = fvm.lduAddr().upperAddr();
+
+			const scalarField& gammaMagSfi = gammaMagSf.primitiveField();
+			const scalarField& deltaCoeffsi = deltaCoeffs.primitiveField();
+
+			scalarField& upper = fvm.upper();
+			scalarField& diag = fvm.diag();
+
+			forAll(upper, facei)
+			{
+				const scalar offDiagCoeff =
+					coeff * deltaCoeffsi[facei] * gammaMagSfi[facei];
+
+				upper[facei] += offDiagCoeff;
+				diag[l[facei]] -= offDiagCoeff;
+				diag[u[facei]] -= offDiagCoeff;
+			}
+
+			// The Laplacian is symmetric: the lower coefficients only need
+			// updating if the matrix has already been made asymmetric
+			if (fvm.hasLower())
+			{
+				scalarField& lower = fvm.lower();
+
+				forAll(lower, facei)
+				{
+					lower[facei] += coeff * deltaCoeffsi[facei] * gammaMagSfi[facei];
+				}
+			}
+
+			forAll(vf.boundaryField(), patchi)
+			{
+				const fvPatchField<Type>& pvf = vf.boundaryField()[patchi];
+				const fvsPatchScalarField& pGamma = gammaMagSf.boundaryField()[patchi];
+				const fvsPatchScalarField& pDeltaCoeffs =
+					deltaCoeffs.boundaryField()[patchi];
+
+				if (pvf.coupled())
+				{
+					fvm.internalCoeffs()[patchi] +=
+						coeff * pGamma * pvf.gradientInternalCoeffs(pDeltaCoeffs);
+					fvm.boundaryCoeffs()[patchi] -=
+						coeff * pGamma * pvf.gradientBoundaryCoeffs(pDeltaCoeffs);
+				}
+				else
+				{
+					fvm.internalCoeffs()[patchi] +=
+						coeff * pGamma * pvf.gradientInternalCoeffs();
+					fvm.boundaryCoeffs()[patchi] -=
+						coeff * pGamma * pvf.gradientBoundaryCoeffs();
+				}
+			}
+		}
+
+
 		template<class Type, class GType>
 		tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>
 			gaussLaplacianScheme<Type, GType>::gammaSnGradCorr
@@ -173,6 +239,65 @@ namespace tnbLib
 		}
 
 
+		template<class Type, class GType>
+		void gaussLaplacianScheme<Type, GType>::addFvmLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			const fvMesh& mesh = this->mesh();
+
+			const surfaceVectorField Sn(mesh.Sf() / mesh.magSf());
+
+			const surfaceVectorField SfGamma(mesh.Sf() & gamma);
+			const GeometricField<scalar, fvsPatchField, surfaceMesh> SfGammaSn
+			(
+				SfGamma & Sn
+			);
+			const surfaceVectorField SfGammaCorr(SfGamma - SfGammaSn * Sn);
+
+			addFvmLaplacianUncorrected
+			(
+				fvm,
+				coeff,
+				SfGammaSn,
+				this->tsnGradScheme_().deltaCoeffs(vf),
+				vf
+			);
+
+			tmp<GeometricField<Type, fvsPatchField, surfaceMesh>> tfaceFluxCorrection
+				= gammaSnGradCorr(SfGammaCorr, vf);
+
+			if (this->tsnGradScheme_().corrected())
+			{
+				tfaceFluxCorrection.ref() +=
+					SfGammaSn * this->tsnGradScheme_().correction(vf);
+			}
+
+			if (coeff != 1)
+			{
+				tfaceFluxCorrection.ref() *= dimensionedScalar(dimless, coeff);
+			}
+
+			fvm.source() -= mesh.V()*fvc::div(tfaceFluxCorrection())().primitiveField();
+
+			if (mesh.fluxRequired(vf.name()))
+			{
+				if (fvm.faceFluxCorrectionPtr())
+				{
+					*fvm.faceFluxCorrectionPtr() += tfaceFluxCorrection();
+				}
+				else
+				{
+					fvm.faceFluxCorrectionPtr() = tfaceFluxCorrection.ptr();
+				}
+			}
+		}
+
+
 		template<class Type, class GType>
 		tmp<GeometricField<Type, fvPatchField, volMesh>>
 			gaussLaplacianScheme<Type, GType>::fvcLaplacian
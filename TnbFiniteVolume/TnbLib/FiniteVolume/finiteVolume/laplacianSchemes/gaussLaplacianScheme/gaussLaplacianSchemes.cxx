@@ -67,6 +67,58 @@ tnbLib::fv::gaussLaplacianScheme<tnbLib::Type, tnbLib::scalar>::fvmLaplacian
                                                                                \
                                                                                \
 template<>                                                                     \
+void tnbLib::fv::gaussLaplacianScheme<tnbLib::Type, tnbLib::scalar>::          \
+addFvmLaplacian                                                                \
+(                                                                              \
+    fvMatrix<Type>& fvm,                                                       \
+    const scalar coeff,                                                        \
+    const GeometricField<scalar, fvsPatchField, surfaceMesh>& gamma,           \
+    const GeometricField<Type, fvPatchField, volMesh>& vf                      \
+)                                                                              \
+{                                                                              \
+    const fvMesh& mesh = this->mesh();                                         \
+                                                                               \
+    GeometricField<scalar, fvsPatchField, surfaceMesh> gammaMagSf              \
+    (                                                                          \
+        gamma*mesh.magSf()                                                     \
+    );                                                                         \
+                                                                               \
+    addFvmLaplacianUncorrected                                                 \
+    (                                                                          \
+        fvm,                                                                   \
+        coeff,                                                                 \
+        gammaMagSf,                                                            \
+        this->tsnGradScheme_().deltaCoeffs(vf),                                \
+        vf                                                                     \
+    );                                                                         \
+                                                                               \
+    if (this->tsnGradScheme_().corrected())                                    \
+    {                                                                          \
+        tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>                  \
+            tfaceFluxCorrection                                                \
+            (                                                                  \
+                coeff*gammaMagSf*this->tsnGradScheme_().correction(vf)         \
+            );                                                                 \
+                                                                               \
+        fvm.source() -=                                                        \
+            mesh.V()*fvc::div(tfaceFluxCorrection())().primitiveField();       \
+                                                                               \
+        if (mesh.fluxRequired(vf.name()))                                      \
+        {                                                                      \
+            if (fvm.faceFluxCorrectionPtr())                                   \
+            {                                                                  \
+                *fvm.faceFluxCorrectionPtr() += tfaceFluxCorrection();         \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                fvm.faceFluxCorrectionPtr() = tfaceFluxCorrection.ptr();       \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+                                                                               \
+template<>                                                                     \
 tnbLib::tmp<tnbLib::GeometricField<tnbLib::Type, tnbLib::fvPatchField, tnbLib::volMesh>> \
 tnbLib::fv::gaussLaplacianScheme<tnbLib::Type, tnbLib::scalar>::fvcLaplacian         \
 (                                                                              \
@@ -79,6 +79,45 @@ namespace tnbLib
 		}
 
 
+		template<class Type, class GType>
+		void laplacianScheme<Type, GType>::addFvmLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			tmp<fvMatrix<Type>> tlaplacian(fvmLaplacian(gamma, vf));
+
+			if (coeff != 1)
+			{
+				tlaplacian.ref() *= dimensionedScalar(dimless, coeff);
+			}
+
+			fvm += tlaplacian;
+		}
+
+
+		template<class Type, class GType>
+		void laplacianScheme<Type, GType>::addFvmLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvPatchField, volMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			addFvmLaplacian
+			(
+				fvm,
+				coeff,
+				tinterpGammaScheme_().interpolate(gamma)(),
+				vf
+			);
+		}
+
+
 		template<class Type, class GType>
 		tmp<GeometricField<Type, fvPatchField, volMesh>>
 			laplacianScheme<Type, GType>::fvcLaplacian
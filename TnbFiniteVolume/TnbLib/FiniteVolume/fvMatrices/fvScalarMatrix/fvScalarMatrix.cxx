@@ -160,6 +160,17 @@ tnbLib::solverPerformance tnbLib::fvMatrix<tnbLib::scalar>::solveSegregated
 }
 
 
+template<>
+tnbLib::solverPerformance tnbLib::fvMatrix<tnbLib::scalar>::solveMultiComponent
+(
+	const dictionary& solverControls
+)
+{
+	// A scalar has a single component so there are no coefficients to share
+	return solveSegregated(solverControls);
+}
+
+
 template<>
 tnbLib::tmp<tnbLib::scalarField> tnbLib::fvMatrix<tnbLib::scalar>::residual() const
 {
@@ -0,0 +1,260 @@
+#include <fvHaloExchange.hxx>
+
+#include <processorFvPatch.hxx>
+#include <globalMeshData.hxx>
+#include <SortableList.hxx>
+
+// * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+	defineTypeNameAndDebug(fvHaloExchange, 0);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+tnbLib::label tnbLib::fvHaloExchange::alignedSize(const label nBytes)
+{
+	const label align = sizeof(scalar);
+
+	return align*((nBytes + align - 1)/align);
+}
+
+
+void tnbLib::fvHaloExchange::calcNeighbours()
+{
+	const fvBoundaryMesh& patches = mesh_.boundary();
+
+	isProcPatch_.setSize(patches.size());
+	isProcPatch_ = false;
+
+	if (!Pstream::parRun())
+	{
+		comm_ = -1;
+		return;
+	}
+
+	// Neighbouring processors from the processor topology
+	neighbProcs_ = mesh_.globalData()[Pstream::myProcNo()];
+
+	labelList procToNeighbour(Pstream::nProcs(), -1);
+	forAll(neighbProcs_, nbri)
+	{
+		procToNeighbour[neighbProcs_[nbri]] = nbri;
+	}
+
+	// Collect the processor patches per neighbour and their tags
+	List<DynamicList<label>> nbrPatches(neighbProcs_.size());
+	List<DynamicList<label>> nbrTags(neighbProcs_.size());
+
+	forAll(patches, patchi)
+	{
+		if (isA<processorFvPatch>(patches[patchi]))
+		{
+			const processorFvPatch& procPatch =
+				refCast<const processorFvPatch>(patches[patchi]);
+
+			const label nbri = procToNeighbour[procPatch.neighbProcNo()];
+
+			if (nbri == -1)
+			{
+				FatalErrorInFunction
+					<< "Processor patch " << procPatch.name()
+					<< " connects to processor " << procPatch.neighbProcNo()
+					<< " which is not a neighbour in the processor topology "
+					<< neighbProcs_
+					<< exit(FatalError);
+			}
+
+			isProcPatch_[patchi] = true;
+			nbrPatches[nbri].append(patchi);
+			nbrTags[nbri].append(procPatch.tag());
+		}
+	}
+
+	// Order the patches of each neighbour consistently on both sides
+	procPatches_.setSize(neighbProcs_.size());
+
+	forAll(nbrPatches, nbri)
+	{
+		SortableList<label> tags(nbrTags[nbri]);
+
+		procPatches_[nbri] =
+			labelList(UIndirectList<label>(nbrPatches[nbri], tags.indices()));
+	}
+
+	comm_ = UPstream::allocateNeighbourCommunicator
+	(
+		neighbProcs_,
+		UPstream::worldComm
+	);
+
+	if (debug)
+	{
+		Pout << "fvHaloExchange : neighbours " << neighbProcs_
+			<< " processor patches " << procPatches_ << endl;
+	}
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+tnbLib::fvHaloExchange::fvHaloExchange(const fvMesh& mesh)
+	:
+	MeshObject<fvMesh, tnbLib::TopologicalMeshObject, fvHaloExchange>(mesh),
+	comm_(-1),
+	neighbProcs_(),
+	procPatches_(),
+	isProcPatch_(),
+	fields_(),
+	sizes_(),
+	offsets_(),
+	sendBuf_(),
+	recvBuf_()
+{
+	calcNeighbours();
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+tnbLib::fvHaloExchange::~fvHaloExchange()
+{
+	UPstream::freeNeighbourCommunicator(comm_);
+}
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+tnbLib::fvHaloExchange& tnbLib::fvHaloExchange::New(const fvMesh& mesh)
+{
+	return const_cast<fvHaloExchange&>
+	(
+		MeshObject<fvMesh, tnbLib::TopologicalMeshObject, fvHaloExchange>::New
+		(
+			mesh
+		)
+	);
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void tnbLib::fvHaloExchange::correctBoundaryConditions()
+{
+	// The processor patches are not scheduled, the other patches are
+	// evaluated as for the blocking exchange
+	const Pstream::commsTypes commsType =
+		Pstream::defaultCommsType == Pstream::commsTypes::nonBlocking
+	  ? Pstream::commsTypes::nonBlocking
+	  : Pstream::commsTypes::blocking;
+
+	const label nReq = Pstream::nRequests();
+
+	forAll(fields_, fieldi)
+	{
+		fields_[fieldi].initEvaluate(commsType);
+	}
+
+	if (comm_ != -1)
+	{
+		// Sizes of the exchange per neighbour. The sizes are symmetric
+		// since the fields are added in the same order on all processors.
+		sizes_.setSize(neighbProcs_.size());
+		offsets_.setSize(neighbProcs_.size());
+
+		label offset = 0;
+
+		forAll(neighbProcs_, nbri)
+		{
+			label nBytes = 0;
+
+			forAll(fields_, fieldi)
+			{
+				forAll(procPatches_[nbri], i)
+				{
+					nBytes += alignedSize
+					(
+						fields_[fieldi].byteSize(procPatches_[nbri][i])
+					);
+				}
+			}
+
+			sizes_[nbri] = nBytes;
+			offsets_[nbri] = offset;
+			offset += nBytes;
+		}
+
+		if (sendBuf_.size() < offset)
+		{
+			sendBuf_.setSize(offset);
+			recvBuf_.setSize(offset);
+		}
+
+		// Pack the patch internal values
+		forAll(neighbProcs_, nbri)
+		{
+			char* buf = sendBuf_.begin() + offsets_[nbri];
+
+			forAll(fields_, fieldi)
+			{
+				forAll(procPatches_[nbri], i)
+				{
+					const label patchi = procPatches_[nbri][i];
+
+					fields_[fieldi].pack(patchi, buf);
+					buf += alignedSize(fields_[fieldi].byteSize(patchi));
+				}
+			}
+		}
+
+		UPstream::neighbourAllToAll
+		(
+			sendBuf_.begin(),
+			sizes_,
+			offsets_,
+			recvBuf_.begin(),
+			sizes_,
+			offsets_,
+			comm_
+		);
+
+		// Evaluate the processor patches from the received values
+		forAll(neighbProcs_, nbri)
+		{
+			const char* buf = recvBuf_.begin() + offsets_[nbri];
+
+			forAll(fields_, fieldi)
+			{
+				forAll(procPatches_[nbri], i)
+				{
+					const label patchi = procPatches_[nbri][i];
+
+					fields_[fieldi].unpack(patchi, buf);
+					buf += alignedSize(fields_[fieldi].byteSize(patchi));
+				}
+			}
+		}
+	}
+
+	// Block for any outstanding requests of the other patches
+	if
+		(
+			Pstream::parRun()
+		 && commsType == Pstream::commsTypes::nonBlocking
+			)
+	{
+		Pstream::waitRequests(nReq);
+	}
+
+	forAll(fields_, fieldi)
+	{
+		fields_[fieldi].evaluate(commsType);
+	}
+
+	fields_.clear();
+}
+
+
+// ************************************************************************* //
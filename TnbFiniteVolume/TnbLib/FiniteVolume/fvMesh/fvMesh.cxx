@@ -15,6 +15,7 @@
 
 #include <Time.hxx>  // added by amir
 #include <fileOperation.hxx>  // added by amir
+#include <firstTouch.hxx>
 #include <MapDimensionedFields.hxx>  // added by amir
 #include <MapGeometricFields.hxx>  // added by amir
 
@@ -301,6 +302,23 @@ tnbLib::fvMesh::fvMesh(const IOobject& io)
 			*this
 		);
 	}
+
+	// Calculate the cache-blocked face order up-front
+	if (lduAddressing::cacheBlockSize)
+	{
+		cacheBlockFaceOrder();
+	}
+
+	// Report the NUMA placement of the main mesh arrays
+	if (firstTouch::numaFirstTouch > 1)
+	{
+		firstTouch::writePlacement(Pout, "points", points());
+		firstTouch::writePlacement(Pout, "owner", faceOwner());
+		firstTouch::writePlacement(Pout, "neighbour", faceNeighbour());
+		firstTouch::writePlacement(Pout, "faceAreas", faceAreas());
+		firstTouch::writePlacement(Pout, "cellCentres", cellCentres());
+		firstTouch::writePlacement(Pout, "cellVolumes", cellVolumes());
+	}
 }
 
 
@@ -158,9 +158,25 @@ tnbLib::surfaceInterpolationScheme<Type>::interpolate
 
 	Field<Type>& sfi = sf.primitiveFieldRef();
 
-	for (label fi = 0; fi < P.size(); fi++)
+	// Traverse the faces in cache-blocked order, if set, for locality of the
+	// cells
+	const labelUList& faceOrder = mesh.cacheBlockFaceOrder();
+
+	if (faceOrder.size())
+	{
+		forAll(faceOrder, i)
+		{
+			const label fi = faceOrder[i];
+
+			sfi[fi] = lambda[fi] * vfi[P[fi]] + y[fi] * vfi[N[fi]];
+		}
+	}
+	else
 	{
-		sfi[fi] = lambda[fi] * vfi[P[fi]] + y[fi] * vfi[N[fi]];
+		for (label fi = 0; fi < P.size(); fi++)
+		{
+			sfi[fi] = lambda[fi] * vfi[P[fi]] + y[fi] * vfi[N[fi]];
+		}
 	}
 
 
@@ -253,9 +269,24 @@ tnbLib::surfaceInterpolationScheme<Type>::dotInterpolate
 
 	const typename SFType::Internal& Sfi = Sf();
 
-	for (label fi = 0; fi < P.size(); fi++)
+	const labelUList& faceOrder = mesh.cacheBlockFaceOrder();
+
+	if (faceOrder.size())
+	{
+		forAll(faceOrder, i)
+		{
+			const label fi = faceOrder[i];
+
+			sfi[fi] =
+				Sfi[fi] & (lambda[fi] * (vfi[P[fi]] - vfi[N[fi]]) + vfi[N[fi]]);
+		}
+	}
+	else
 	{
-		sfi[fi] = Sfi[fi] & (lambda[fi] * (vfi[P[fi]] - vfi[N[fi]]) + vfi[N[fi]]);
+		for (label fi = 0; fi < P.size(); fi++)
+		{
+			sfi[fi] = Sfi[fi] & (lambda[fi] * (vfi[P[fi]] - vfi[N[fi]]) + vfi[N[fi]]);
+		}
 	}
 
 	// Interpolate across coupled patches using given lambdas
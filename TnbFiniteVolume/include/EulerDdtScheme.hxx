@@ -158,6 +158,19 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>& psi
 			);
 
+			virtual void addFvmDdt
+			(
+				fvMatrix<Type>&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
+			virtual void addFvmDdt
+			(
+				fvMatrix<Type>&,
+				const volScalarField&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
 			typedef typename ddtScheme<Type>::fluxFieldType fluxFieldType;
 
 			virtual tmp<fluxFieldType> fvcDdtUfCorr
@@ -22,6 +22,7 @@
 #include <findRefCell.hxx>
 #include <IOMRFZoneList.hxx>
 #include <constants.hxx>
+#include <reduceBatch.hxx>
 
 #include <OSspecific.hxx>
 #include <argList.hxx>
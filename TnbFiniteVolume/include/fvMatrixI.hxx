@@ -1294,6 +1294,39 @@ void tnbLib::checkMethod
 }
 
 
+template<class Type>
+void tnbLib::checkMethod
+(
+	const fvMatrix<Type>& fvm,
+	const GeometricField<Type, fvPatchField, volMesh>& psi,
+	const dimensionSet& ds,
+	const char* op
+)
+{
+	if (&fvm.psi() != &psi)
+	{
+		FatalErrorInFunction
+			<< "incompatible fields for operation "
+			<< endl << "    "
+			<< "[" << fvm.psi().name() << "] "
+			<< op
+			<< " [" << psi.name() << "]"
+			<< abort(FatalError);
+	}
+
+	if (dimensionSet::debug && fvm.dimensions() != ds)
+	{
+		FatalErrorInFunction
+			<< "incompatible dimensions for operation "
+			<< endl << "    "
+			<< "[" << fvm.psi().name() << fvm.dimensions() / dimVolume << " ] "
+			<< op
+			<< " [" << psi.name() << ds / dimVolume << " ]"
+			<< abort(FatalError);
+	}
+}
+
+
 template<class Type>
 tnbLib::tmp<tnbLib::fvMatrix<Type>> tnbLib::correction
 (
@@ -75,6 +75,12 @@ namespace tnbLib
 		const dictionary&
 	);
 
+	template<>
+	FoamFiniteVolume_EXPORT solverPerformance fvMatrix<scalar>::solveMultiComponent
+	(
+		const dictionary&
+	);
+
 	template<>
 	FoamFiniteVolume_EXPORT tmp<scalarField> fvMatrix<scalar>::residual() const;
 
@@ -28,10 +28,27 @@ namespace tnbLib
 
 			const Field<Type>& issf = ssf;
 
-			forAll(owner, facei)
+			// Traverse the faces in cache-blocked order, if set, for locality
+			// of the cells scattered to
+			const labelUList& faceOrder = mesh.cacheBlockFaceOrder();
+
+			if (faceOrder.size())
+			{
+				forAll(faceOrder, i)
+				{
+					const label facei = faceOrder[i];
+
+					ivf[owner[facei]] += issf[facei];
+					ivf[neighbour[facei]] -= issf[facei];
+				}
+			}
+			else
 			{
-				ivf[owner[facei]] += issf[facei];
-				ivf[neighbour[facei]] -= issf[facei];
+				forAll(owner, facei)
+				{
+					ivf[owner[facei]] += issf[facei];
+					ivf[neighbour[facei]] -= issf[facei];
+				}
 			}
 
 			forAll(mesh.boundary(), patchi)
@@ -138,10 +155,25 @@ namespace tnbLib
 			const labelUList& owner = mesh.owner();
 			const labelUList& neighbour = mesh.neighbour();
 
-			forAll(owner, facei)
+			const labelUList& faceOrder = mesh.cacheBlockFaceOrder();
+
+			if (faceOrder.size())
+			{
+				forAll(faceOrder, i)
+				{
+					const label facei = faceOrder[i];
+
+					vf[owner[facei]] += ssf[facei];
+					vf[neighbour[facei]] += ssf[facei];
+				}
+			}
+			else
 			{
-				vf[owner[facei]] += ssf[facei];
-				vf[neighbour[facei]] += ssf[facei];
+				forAll(owner, facei)
+				{
+					vf[owner[facei]] += ssf[facei];
+					vf[neighbour[facei]] += ssf[facei];
+				}
 			}
 
 			forAll(mesh.boundary(), patchi)
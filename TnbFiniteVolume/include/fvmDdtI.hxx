@@ -137,6 +137,49 @@ namespace tnbLib
 		}
 
 
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+		template<class Type>
+		void addDdt
+		(
+			fvMatrix<Type>& fvm,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			checkMethod(fvm, vf, vf.dimensions()*dimVol / dimTime, "addDdt");
+
+			fv::ddtScheme<Type>::New
+			(
+				vf.mesh(),
+				vf.mesh().ddtScheme("ddt(" + vf.name() + ')')
+			).ref().addFvmDdt(fvm, vf);
+		}
+
+
+		template<class Type>
+		void addDdt
+		(
+			fvMatrix<Type>& fvm,
+			const volScalarField& rho,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			checkMethod
+			(
+				fvm,
+				vf,
+				rho.dimensions()*vf.dimensions()*dimVol / dimTime,
+				"addDdt"
+			);
+
+			fv::ddtScheme<Type>::New
+			(
+				vf.mesh(),
+				vf.mesh().ddtScheme("ddt(" + rho.name() + ',' + vf.name() + ')')
+			).ref().addFvmDdt(fvm, rho, vf);
+		}
+
+
 		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 	} // End namespace fvm
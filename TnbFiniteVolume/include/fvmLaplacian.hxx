@@ -29,7 +29,8 @@ InNamespace
 	tnbLib::fvm
 
 Description
-	Calculate the matrix for the laplacian of the field.
+	Calculate the matrix for the laplacian of the field
+	or add it in place to an existing matrix.
 
 SourceFiles
 	fvmLaplacian.C
@@ -176,6 +177,61 @@ namespace tnbLib
 			const tmp<GeometricField<GType, fvsPatchField, surfaceMesh>>&,
 			const GeometricField<Type, fvPatchField, volMesh>&
 		);
+
+
+		// In-place assembly
+
+		//- Add coeff*laplacian(gamma, vf) to the given matrix
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>&,
+			const scalar coeff,
+			const dimensioned<GType>&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
+
+		//- Add coeff*laplacian(gamma, vf) to the given matrix
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>&,
+			const scalar coeff,
+			const GeometricField<GType, fvPatchField, volMesh>&,
+			const GeometricField<Type, fvPatchField, volMesh>&,
+			const word& name
+		);
+
+		//- Add coeff*laplacian(gamma, vf) to the given matrix
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>&,
+			const scalar coeff,
+			const GeometricField<GType, fvPatchField, volMesh>&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
+
+		//- Add coeff*laplacian(gamma, vf) to the given matrix
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>&,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>&,
+			const GeometricField<Type, fvPatchField, volMesh>&,
+			const word& name
+		);
+
+		//- Add coeff*laplacian(gamma, vf) to the given matrix
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>&,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
 	}
 
 
@@ -137,6 +137,16 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>&
 			) const;
 
+			//- Add coeff*fvmDiv(faceFlux, vf) directly to the coefficients
+			//  of the given matrix
+			void addFvmDiv
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const surfaceScalarField&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			) const;
+
 			tmp<GeometricField<Type, fvPatchField, volMesh>> fvcDiv
 			(
 				const surfaceScalarField&,
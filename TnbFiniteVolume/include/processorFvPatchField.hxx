@@ -99,6 +99,14 @@ namespace tnbLib
 		//- Scalar receive buffer
 		mutable Field<scalar> scalarReceiveBuf_;
 
+		//- Persistent channels of the buffers and of the patch field,
+		//  see UPstream::persistentRequests
+		mutable label sendChannel_;
+		mutable label receiveChannel_;
+		mutable label patchReceiveChannel_;
+		mutable label scalarSendChannel_;
+		mutable label scalarReceiveChannel_;
+
 	public:
 
 		//- Runtime type information
@@ -208,6 +216,10 @@ namespace tnbLib
 		//- Evaluate the patch field
 		virtual void evaluate(const Pstream::commsTypes commsType);
 
+		//- Evaluate the patch field given the patch internal field of the
+		//  neighbour, received by an aggregated exchange (fvHaloExchange)
+		void evaluate(const UList<Type>& nbrPatchInternalField);
+
 		//- Return patch-normal gradient
 		virtual tmp<Field<Type>> snGrad
 		(
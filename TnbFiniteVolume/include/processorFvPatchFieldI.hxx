@@ -18,7 +18,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(0),
-	scalarReceiveBuf_(0)
+	scalarReceiveBuf_(0),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {}
 
 
@@ -37,7 +42,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(0),
-	scalarReceiveBuf_(0)
+	scalarReceiveBuf_(0),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {}
 
 
@@ -56,7 +66,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(0),
-	scalarReceiveBuf_(0)
+	scalarReceiveBuf_(0),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {
 	if (!isA<processorFvPatch>(p))
 	{
@@ -95,7 +110,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(0),
-	scalarReceiveBuf_(0)
+	scalarReceiveBuf_(0),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {
 	if (!isA<processorFvPatch>(this->patch()))
 	{
@@ -129,7 +149,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(move(ptf.scalarSendBuf_)),
-	scalarReceiveBuf_(move(ptf.scalarReceiveBuf_))
+	scalarReceiveBuf_(move(ptf.scalarReceiveBuf_)),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {
 	if (debug && !ptf.ready())
 	{
@@ -154,7 +179,12 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 	outstandingSendRequest_(-1),
 	outstandingRecvRequest_(-1),
 	scalarSendBuf_(0),
-	scalarReceiveBuf_(0)
+	scalarReceiveBuf_(0),
+	sendChannel_(-1),
+	receiveChannel_(-1),
+	patchReceiveChannel_(-1),
+	scalarSendChannel_(-1),
+	scalarReceiveChannel_(-1)
 {
 	if (debug && !ptf.ready())
 	{
@@ -169,7 +199,13 @@ tnbLib::processorFvPatchField<Type>::processorFvPatchField
 
 template<class Type>
 tnbLib::processorFvPatchField<Type>::~processorFvPatchField()
-{}
+{
+	UPstream::freeChannel(sendChannel_);
+	UPstream::freeChannel(receiveChannel_);
+	UPstream::freeChannel(patchReceiveChannel_);
+	UPstream::freeChannel(scalarSendChannel_);
+	UPstream::freeChannel(scalarReceiveChannel_);
+}
 
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
@@ -203,6 +239,7 @@ void tnbLib::processorFvPatchField<Type>::initEvaluate
 			(
 				commsType == Pstream::commsTypes::nonBlocking
 				&& !Pstream::floatTransfer
+				&& !procPatch_.sharedMemory()
 				)
 		{
 			// Fast path. Receive into *this
@@ -210,7 +247,7 @@ void tnbLib::processorFvPatchField<Type>::initEvaluate
 			outstandingRecvRequest_ = UPstream::nRequests();
 			UIPstream::read
 			(
-				Pstream::commsTypes::nonBlocking,
+				patchReceiveChannel_,
 				procPatch_.neighbProcNo(),
 				reinterpret_cast<char*>(this->begin()),
 				this->byteSize(),
@@ -221,7 +258,7 @@ void tnbLib::processorFvPatchField<Type>::initEvaluate
 			outstandingSendRequest_ = UPstream::nRequests();
 			UOPstream::write
 			(
-				Pstream::commsTypes::nonBlocking,
+				sendChannel_,
 				procPatch_.neighbProcNo(),
 				reinterpret_cast<const char*>(sendBuf_.begin()),
 				this->byteSize(),
@@ -249,6 +286,7 @@ void tnbLib::processorFvPatchField<Type>::evaluate
 			(
 				commsType == Pstream::commsTypes::nonBlocking
 				&& !Pstream::floatTransfer
+				&& !procPatch_.sharedMemory()
 				)
 		{
 			// Fast path. Received into *this
@@ -277,6 +315,21 @@ void tnbLib::processorFvPatchField<Type>::evaluate
 }
 
 
+template<class Type>
+void tnbLib::processorFvPatchField<Type>::evaluate
+(
+	const UList<Type>& nbrPatchInternalField
+)
+{
+	Field<Type>::operator=(nbrPatchInternalField);
+
+	if (doTransform())
+	{
+		transform(*this, procPatch_.forwardT(), *this);
+	}
+}
+
+
 template<class Type>
 tnbLib::tmp<tnbLib::Field<Type>>
 tnbLib::processorFvPatchField<Type>::snGrad
@@ -304,6 +357,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procPatch_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -320,7 +374,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		outstandingRecvRequest_ = UPstream::nRequests();
 		UIPstream::read
 		(
-			Pstream::commsTypes::nonBlocking,
+			scalarReceiveChannel_,
 			procPatch_.neighbProcNo(),
 			reinterpret_cast<char*>(scalarReceiveBuf_.begin()),
 			scalarReceiveBuf_.byteSize(),
@@ -331,7 +385,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		outstandingSendRequest_ = UPstream::nRequests();
 		UOPstream::write
 		(
-			Pstream::commsTypes::nonBlocking,
+			scalarSendChannel_,
 			procPatch_.neighbProcNo(),
 			reinterpret_cast<const char*>(scalarSendBuf_.begin()),
 			scalarSendBuf_.byteSize(),
@@ -369,6 +423,7 @@ void tnbLib::processorFvPatchField<Type>::updateInterfaceMatrix
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procPatch_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -431,6 +486,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procPatch_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -447,7 +503,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		outstandingRecvRequest_ = UPstream::nRequests();
 		IPstream::read
 		(
-			Pstream::commsTypes::nonBlocking,
+			receiveChannel_,
 			procPatch_.neighbProcNo(),
 			reinterpret_cast<char*>(receiveBuf_.begin()),
 			receiveBuf_.byteSize(),
@@ -458,7 +514,7 @@ void tnbLib::processorFvPatchField<Type>::initInterfaceMatrixUpdate
 		outstandingSendRequest_ = UPstream::nRequests();
 		OPstream::write
 		(
-			Pstream::commsTypes::nonBlocking,
+			sendChannel_,
 			procPatch_.neighbProcNo(),
 			reinterpret_cast<const char*>(sendBuf_.begin()),
 			sendBuf_.byteSize(),
@@ -495,6 +551,7 @@ void tnbLib::processorFvPatchField<Type>::updateInterfaceMatrix
 		(
 			commsType == Pstream::commsTypes::nonBlocking
 			&& !Pstream::floatTransfer
+			&& !procPatch_.sharedMemory()
 			)
 	{
 		// Fast path.
@@ -8,6 +8,7 @@
 #include <absorptionEmissionModel.hxx>
 
 #include <surfaceInterpolate.hxx>
+#include <taskParallel.hxx>
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -254,29 +255,51 @@ namespace tnbLib
 
 				volScalarField Yt(0.0*Ys_[0]);
 
+				// Evaluate the data shared by the species equations before
+				// solving them concurrently
+				rho_.oldTime();
+
 				for (label i = 0; i < Ys_.size() - 1; i++)
 				{
-					volScalarField& Yi = Ys_[i];
+					Ys_[i].oldTime();
+				}
 
-					fvScalarMatrix YiEqn
-					(
-						fvm::ddt(rho_, Yi) == solidChemistry_->RRs(i)
-					);
+				if (regionMesh().moving())
+				{
+					regionMesh().weights();
+				}
 
-					if (regionMesh().moving())
+				taskParallel::run
+				(
+					Ys_.size() - 1,
+					[&](const label i)
 					{
-						surfaceScalarField phiYiRhoMesh
+						volScalarField& Yi = Ys_[i];
+
+						fvScalarMatrix YiEqn
 						(
-							fvc::interpolate(Yi*rho_)*regionMesh().phi()
+							fvm::ddt(rho_, Yi) == solidChemistry_->RRs(i)
 						);
 
-						YiEqn += fvc::div(phiYiRhoMesh);
+						if (regionMesh().moving())
+						{
+							surfaceScalarField phiYiRhoMesh
+							(
+								fvc::interpolate(Yi*rho_)*regionMesh().phi()
+							);
+
+							YiEqn += fvc::div(phiYiRhoMesh);
+
+						}
 
+						YiEqn.solve("Yi");
+						Yi.max(0.0);
 					}
+				);
 
-					YiEqn.solve("Yi");
-					Yi.max(0.0);
-					Yt += Yi;
+				for (label i = 0; i < Ys_.size() - 1; i++)
+				{
+					Yt += Ys_[i];
 				}
 
 				Ys_[Ys_.size() - 1] = 1.0 - Yt;
@@ -11,6 +11,7 @@
 #include <mappedWallPolyPatch.hxx>
 #include <mapDistribute.hxx>
 #include <filmThermoModel.hxx>
+#include <fvHaloExchange.hxx>
 
 #include <zeroGradientFvPatchFields.hxx>  // added by amir
 #include <PstreamReduceOps.hxx>  // added by amir
@@ -81,10 +82,12 @@ namespace tnbLib
 
 				// Update fields from primary region via direct mapped
 				// (coupled) boundary conditions
-				UPrimary_.correctBoundaryConditions();
-				pPrimary_.correctBoundaryConditions();
-				rhoPrimary_.correctBoundaryConditions();
-				muPrimary_.correctBoundaryConditions();
+				fvHaloExchange& halo = fvHaloExchange::New(regionMesh());
+				halo.add(UPrimary_);
+				halo.add(pPrimary_);
+				halo.add(rhoPrimary_);
+				halo.add(muPrimary_);
+				halo.correctBoundaryConditions();
 			}
 
 
@@ -123,9 +126,11 @@ namespace tnbLib
 				// (coupled) boundary conditions
 				// - fields require transfer of values for both patch AND to push the
 				//   values into the first layer of internal cells
-				rhoSp_.correctBoundaryConditions();
-				USp_.correctBoundaryConditions();
-				pSp_.correctBoundaryConditions();
+				fvHaloExchange& halo = fvHaloExchange::New(regionMesh());
+				halo.add(rhoSp_);
+				halo.add(USp_);
+				halo.add(pSp_);
+				halo.correctBoundaryConditions();
 
 				// update addedMassTotal counter
 				if (time().writeTime())
@@ -10,6 +10,7 @@
 #include <mapDistribute.hxx>
 #include <constants.hxx>
 #include <addToRunTimeSelectionTable.hxx>
+#include <fvHaloExchange.hxx>
 
 // Sub-models
 #include <filmThermoModel.hxx>
@@ -134,11 +135,13 @@ namespace tnbLib
 
 				// Update primary region fields on local region via direct mapped (coupled)
 				// boundary conditions
-				TPrimary_.correctBoundaryConditions();
+				fvHaloExchange& halo = fvHaloExchange::New(regionMesh());
+				halo.add(TPrimary_);
 				forAll(YPrimary_, i)
 				{
-					YPrimary_[i].correctBoundaryConditions();
+					halo.add(YPrimary_[i]);
 				}
+				halo.correctBoundaryConditions();
 			}
 
 
@@ -38,6 +38,7 @@ SourceFiles
 \*---------------------------------------------------------------------------*/
 
 #include <volFields.hxx>
+#include <fvHaloExchange.hxx>
 #include <typeInfo.hxx>
 #include <autoPtr.hxx>
 #include <runTimeSelectionTables.hxx>
@@ -70,10 +71,15 @@ namespace tnbLib
 		//  GeometricField::InternalField and filters will take a
 		//  tmp<GeometricField::InternalField> argument and handle the coupled BCs
 		//  appropriately
+		//
+		//  The processor patch values are exchanged by the aggregated
+		//  exchange of the mesh (fvHaloExchange)
 		template<class GeoFieldType>
 		void correctBoundaryConditions(const tmp<GeoFieldType>& tgf) const
 		{
-			const_cast<GeoFieldType&>(tgf()).correctBoundaryConditions();
+			fvHaloExchange& halo = fvHaloExchange::New(mesh_);
+			halo.add(const_cast<GeoFieldType&>(tgf()));
+			halo.correctBoundaryConditions();
 		}
 
 
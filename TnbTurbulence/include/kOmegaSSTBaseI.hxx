@@ -119,7 +119,25 @@ namespace tnbLib
 			const volScalarField::Internal& G
 		) const
 	{
-		return min(G, (c1_*betaStar_)*this->k_()*this->omega_());
+		tmp<volScalarField::Internal> tPk
+		(
+			volScalarField::Internal::New
+			(
+				IOobject::groupName("Pk", this->alphaRhoPhi_.group()),
+				this->mesh_,
+				G.dimensions()
+			)
+		);
+
+		// Evaluate the limited production in a single loop over the cells
+		tPk.ref().field() = min
+		(
+			fieldExpr(G.field()),
+			(c1_*betaStar_).value()
+		   *fieldExpr(k_.primitiveField())*omega_.primitiveField()
+		);
+
+		return tPk;
 	}
 
 
@@ -435,6 +453,30 @@ namespace tnbLib
 			volScalarField::Internal gamma(this->gamma(F1));
 			volScalarField::Internal beta(this->beta(F1));
 
+			// Limited production of omega, evaluated in a single loop over
+			// the cells
+			tmp<volScalarField::Internal> tGbyNuLim
+			(
+				volScalarField::Internal::New
+				(
+					IOobject::groupName("GbyNuLim", this->alphaRhoPhi_.group()),
+					this->mesh_,
+					GbyNu.dimensions()
+				)
+			);
+			tGbyNuLim.ref().field() = min
+			(
+				fieldExpr(GbyNu.field()),
+				((c1_ / a1_)*betaStar_).value()
+			   *fieldExpr(omega_.primitiveField())
+			   *max
+				(
+					a1_.value()*fieldExpr(omega_.primitiveField()),
+					b1_.value()*fieldExpr(F23.primitiveField())
+				   *sqrt(fieldExpr(S2.primitiveField()))
+				)
+			);
+
 			// Turbulent frequency equation
 			tmp<fvScalarMatrix> omegaEqn
 			(
@@ -442,13 +484,7 @@ namespace tnbLib
 				+ fvm::div(alphaRhoPhi, omega_)
 				- fvm::laplacian(alpha*rho*DomegaEff(F1), omega_)
 				==
-				alpha()*rho()*gamma
-				*min
-				(
-					GbyNu,
-					(c1_ / a1_)*betaStar_*omega_()
-					*max(a1_*omega_(), b1_*F23()*sqrt(S2()))
-				)
+				alpha()*rho()*gamma*tGbyNuLim
 				- fvm::SuSp((2.0 / 3.0)*alpha()*rho()*gamma*divU, omega_)
 				- fvm::Sp(alpha()*rho()*beta*omega_(), omega_)
 				- fvm::SuSp
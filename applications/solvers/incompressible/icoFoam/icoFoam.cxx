@@ -62,12 +62,12 @@ int main(int argc, char* argv[])
 
         // Momentum predictor
 
-        fvVectorMatrix UEqn
-        (
-            fvm::ddt(U)
-            + fvm::div(phi, U)
-            - fvm::laplacian(nu, U)
-        );
+        // Assembled in place to avoid a separate matrix per term
+        fvVectorMatrix UEqn(U, dimVol*dimVelocity/dimTime);
+
+        fvm::addDdt(UEqn, U);
+        fvm::addDiv(UEqn, phi, U);
+        fvm::addLaplacian(UEqn, -1, nu, U);
 
         if (piso.momentumPredictor())
         {
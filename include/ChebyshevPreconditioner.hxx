@@ -0,0 +1,129 @@
+#pragma once
+#ifndef _ChebyshevPreconditioner_Header
+#define _ChebyshevPreconditioner_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::ChebyshevPreconditioner
+
+Description
+	Jacobi-preconditioned Chebyshev polynomial preconditioner, see
+	ChebyshevSmoother.
+
+	The preconditioned residual is obtained by applying the Chebyshev
+	polynomial of the given degree to the residual, starting from zero.
+	The largest eigenvalue of D^-1 A is estimated on construction.
+
+	Example:
+	\verbatim
+	preconditioner
+	{
+		preconditioner  Chebyshev;
+		degree          4;      // Optional, default 4
+		nEigenIters     10;     // Optional, default 10
+		eigenvalueRatio 30;     // Optional, default 30
+	}
+	\endverbatim
+
+SourceFiles
+	ChebyshevPreconditioner.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <lduMatrix.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class ChebyshevPreconditioner Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class ChebyshevPreconditioner
+		:
+		public lduMatrix::preconditioner
+	{
+		// Private Data
+
+			//- The reciprocal diagonal
+		scalarField rD_;
+
+		//- Degree of the polynomial
+		label degree_;
+
+		//- Ratio of the largest to the smallest eigenvalue of the interval
+		scalar eigenvalueRatio_;
+
+		//- Estimate of the largest eigenvalue of D^-1 A
+		scalar lambdaMax_;
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("Chebyshev");
+		static const char* typeName_() { return "Chebyshev"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct from matrix components and preconditioner solver controls
+		FoamBase_EXPORT ChebyshevPreconditioner
+		(
+			const lduMatrix::solver&,
+			const dictionary& solverControls
+		);
+
+
+		//- Destructor
+		virtual ~ChebyshevPreconditioner()
+		{}
+
+
+		// Member Functions
+
+			//- Return wA the preconditioned form of residual rA
+		FoamBase_EXPORT virtual void precondition
+		(
+			scalarField& wA,
+			const scalarField& rA,
+			const direction cmpt = 0
+		) const;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_ChebyshevPreconditioner_Header
@@ -0,0 +1,183 @@
+#pragma once
+#ifndef _ChebyshevSmoother_Header
+#define _ChebyshevSmoother_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::ChebyshevSmoother
+
+Description
+	Jacobi-preconditioned Chebyshev polynomial smoother.
+
+	Each call applies the Chebyshev polynomial of degree nSweeps in
+	D^-1 A which damps the error components with eigenvalues in
+	[lambdaMax/eigenvalueRatio, lambdaMax]. The only kernels are the matrix
+	multiplication and vector updates, so the smoother is free of the
+	sequential recurrences of the Gauss-Seidel and incomplete factorisation
+	smoothers and parallelises and vectorises with the matrix
+	multiplication.
+
+	The largest eigenvalue of D^-1 A is estimated on first use from a few
+	iterations of the Jacobi-preconditioned conjugate gradient method
+	(Lanczos) for symmetric matrices or of the power method for asymmetric
+	matrices, and is increased by the factor eigenvalueBoost to bound the
+	spectrum safely. GAMG caches the estimate of each level between its
+	smoothers and sets it with lambdaMax(const scalar) while the
+	coefficients of the level are unchanged.
+
+SourceFiles
+	ChebyshevSmoother.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <lduMatrix.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class ChebyshevSmoother Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class ChebyshevSmoother
+		:
+		public lduMatrix::smoother
+	{
+		// Private Data
+
+			//- The reciprocal diagonal
+		scalarField rD_;
+
+		//- Estimate of the largest eigenvalue of D^-1 A, -1 until estimated
+		mutable scalar lambdaMax_;
+
+
+		// Private Member Functions
+
+			//- Return the largest eigenvalue of the symmetric tridiagonal
+			//  matrix with the given diagonal and off-diagonal
+		static scalar maxEigenvalue
+		(
+			const scalarList& diag,
+			const scalarList& offDiag
+		);
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("Chebyshev");
+		static const char* typeName_() { return "Chebyshev"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Static Data
+
+			//- Default number of iterations of the eigenvalue estimate
+		static FoamBase_EXPORT const label nEigenIters;
+
+		//- Default factor applied to the estimated largest eigenvalue
+		static FoamBase_EXPORT const scalar eigenvalueBoost;
+
+		//- Default ratio of the largest to the smallest damped eigenvalue
+		static FoamBase_EXPORT const scalar eigenvalueRatio;
+
+
+		// Constructors
+
+			//- Construct from matrix components
+		FoamBase_EXPORT ChebyshevSmoother
+		(
+			const word& fieldName,
+			const lduMatrix& matrix,
+			const FieldField<Field, scalar>& interfaceBouCoeffs,
+			const FieldField<Field, scalar>& interfaceIntCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces
+		);
+
+
+		// Member Functions
+
+			//- Return the estimated largest eigenvalue of D^-1 A for the
+			//  given reciprocal diagonal rD, not including eigenvalueBoost
+		static FoamBase_EXPORT scalar estimateMaxEigenvalue
+		(
+			const lduMatrix& matrix,
+			const FieldField<Field, scalar>& interfaceBouCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			const scalarField& rD,
+			const label nIters,
+			const direction cmpt
+		);
+
+		//- Apply the Chebyshev polynomial of the given degree damping the
+		//  eigenvalues of D^-1 A in [lambdaMin, lambdaMax] to psi
+		static FoamBase_EXPORT void smooth
+		(
+			scalarField& psi,
+			const lduMatrix& matrix,
+			const scalarField& source,
+			const FieldField<Field, scalar>& interfaceBouCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			const scalarField& rD,
+			const scalar lambdaMin,
+			const scalar lambdaMax,
+			const direction cmpt,
+			const label degree
+		);
+
+		//- Return the estimated largest eigenvalue of D^-1 A, estimating
+		//  it if not yet estimated or set
+		FoamBase_EXPORT scalar lambdaMax() const;
+
+		//- Set the largest eigenvalue of D^-1 A, e.g. from a cached estimate
+		void lambdaMax(const scalar lambdaMax)
+		{
+			lambdaMax_ = lambdaMax;
+		}
+
+		//- Smooth the solution for a given number of sweeps
+		FoamBase_EXPORT virtual void smooth
+		(
+			scalarField& psi,
+			const scalarField& source,
+			const direction cmpt,
+			const label nSweeps
+		) const;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_ChebyshevSmoother_Header
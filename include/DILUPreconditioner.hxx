@@ -33,6 +33,10 @@ Description
 	matrices.  The reciprocal of the preconditioned diagonal is calculated
 	and stored.
 
+	With thread blocks (nThreads > 1) the sweeps of precondition are
+	executed row by row in the level order of lduLevelSchedule, the rows of
+	each level in parallel, giving results identical to the serial sweeps.
+
 SourceFiles
 	DILUPreconditioner.C
 
@@ -61,6 +61,10 @@ namespace tnbLib
 	template<class Type>
 	class SubField;
 
+	//- Pre-declare the expression template base type
+	template<class Expr>
+	class FieldExpression;
+
 	template<class Type>
 	void writeEntry(Ostream& os, const Field<Type>&);
 
@@ -153,6 +157,10 @@ namespace tnbLib
 		//- Copy constructor of tmp<Field>
 		Field(const tmp<Field<Type>>&);
 
+		//- Construct by evaluating the given expression
+		template<class Expr>
+		Field(const FieldExpression<Expr>&);
+
 		//- Construct by 1 to 1 mapping from the given field
 		Field
 		(
@@ -299,6 +307,16 @@ namespace tnbLib
 		template<class Form, class Cmpt, direction nCmpt>
 		void operator=(const VectorSpace<Form, Cmpt, nCmpt>&);
 
+		//- Assign the expression, evaluated in a single loop
+		template<class Expr>
+		void operator=(const FieldExpression<Expr>&);
+
+		template<class Expr>
+		void operator+=(const FieldExpression<Expr>&);
+
+		template<class Expr>
+		void operator-=(const FieldExpression<Expr>&);
+
 		void operator+=(const UList<Type>&);
 		void operator+=(const tmp<Field<Type>>&);
 
@@ -335,6 +353,7 @@ namespace tnbLib
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 #include <FieldFunctions.hxx>
+#include <FieldExpression.hxx>
 #include <FieldI.hxx>
 
 //#ifdef NoRepository
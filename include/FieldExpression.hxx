@@ -0,0 +1,743 @@
+#pragma once
+#ifndef _FieldExpression_Header
+#define _FieldExpression_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::FieldExpression
+
+Description
+	Lazy expression templates for Field arithmetic.
+
+	An expression started with fieldExpr() records the operations applied
+	to it without evaluating them. The whole expression is evaluated
+	element by element in a single loop when it is assigned to a Field (=,
+	+= or -=), used to construct a Field or converted to a tmp<Field> by
+	evaluate(), so no intermediate fields are allocated and the operands
+	are streamed from memory only once:
+
+	\verbatim
+		scalarField result(a.size());
+		result = fieldExpr(a)*b + fieldExpr(c)*d - e;
+
+		tmp<scalarField> tresult = evaluate(2*fieldExpr(tk)/max(omega, small));
+	\endverbatim
+
+	Once an expression is started the remaining operands may be Fields
+	(UList), tmp<Field> or scalars. A temporary tmp<Field> operand is
+	transferred into the expression, which is then its only owner, as the
+	tmp would be consumed by the Field operators. An expression holding one
+	therefore cannot be copied; it is moved into the enclosing expression,
+	so a named expression can be evaluated or assigned but not used as an
+	operand again. When a temporary expression is evaluated by evaluate()
+	the storage of its first temporary operand of the result type is
+	reused for the result, following the tmp reuse of the Field operators.
+	A named expression is evaluated into new storage so that its operands
+	are left unchanged.
+
+	The supported operations are +, -, *, /, & (inner product), unary -,
+	max, min, mag, magSqr, sqr, sqrt, exp and log.
+
+SourceFiles
+	FieldExpression.H
+
+\*---------------------------------------------------------------------------*/
+
+#include <tmp.hxx>
+#include <UList.hxx>
+#include <scalar.hxx>
+
+#include <utility>
+#include <type_traits>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	template<class Type>
+	class Field;
+
+	/*---------------------------------------------------------------------------*\
+							   Class FieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Base class of the expressions, Expr being the derived expression
+	template<class Expr>
+	class FieldExpression
+	{
+	public:
+
+		// Member Operators
+
+			//- Return the derived expression
+		const Expr& operator()() const
+		{
+			return static_cast<const Expr&>(*this);
+		}
+	};
+
+
+	//- Whether E, ignoring references and const, is an expression
+	template<class E>
+	struct isFieldExpression
+		:
+		std::is_base_of
+		<
+			FieldExpression<typename std::decay<E>::type>,
+			typename std::decay<E>::type
+		>
+	{};
+
+
+	/*---------------------------------------------------------------------------*\
+							   Class UListFieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Expression of a UList operand
+	template<class Type>
+	class UListFieldExpression
+		:
+		public FieldExpression<UListFieldExpression<Type>>
+	{
+		// Private Data
+
+			//- Reference to the operand
+		const UList<Type>& list_;
+
+
+	public:
+
+		typedef Type value_type;
+
+
+		// Constructors
+
+			//- Construct from the operand
+		explicit UListFieldExpression(const UList<Type>& list)
+			:
+			list_(list)
+		{}
+
+
+		// Member Functions
+
+			//- Return the size of the operand
+		label size() const
+		{
+			return list_.size();
+		}
+
+		//- Return false, the operand is not reusable
+		template<class TypeR>
+		bool reuseTmp(tmp<Field<TypeR>>&) const
+		{
+			return false;
+		}
+
+
+		// Member Operators
+
+			//- Return element i
+		const Type& operator[](const label i) const
+		{
+			return list_[i];
+		}
+	};
+
+
+	/*---------------------------------------------------------------------------*\
+							   Class tmpFieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Expression of a tmp<Field> operand, held until the expression is
+	//  destroyed. A temporary operand is transferred into the expression and
+	//  then moved into the enclosing expression, so it has a single owner
+	template<class Type>
+	class tmpFieldExpression
+		:
+		public FieldExpression<tmpFieldExpression<Type>>
+	{
+		// Private Data
+
+			//- The operand
+		tmp<Field<Type>> tf_;
+
+
+	public:
+
+		typedef Type value_type;
+
+
+		// Constructors
+
+			//- Construct from the operand, transferring it from the caller
+		explicit tmpFieldExpression(const tmp<Field<Type>>& tf)
+			:
+			tf_(tf, true)
+		{}
+
+		//- Move constructor, transferring the operand
+		tmpFieldExpression(tmpFieldExpression<Type>&& e)
+			:
+			tf_(e.tf_, true)
+		{}
+
+		//- Disallow copy construction, which would share the operand
+		tmpFieldExpression(const tmpFieldExpression<Type>&) = delete;
+
+
+		// Member Functions
+
+			//- Return the size of the operand
+		label size() const
+		{
+			return tf_().size();
+		}
+
+		//- Return false, the operand is not of the result type
+		template<class TypeR>
+		bool reuseTmp(tmp<Field<TypeR>>&) const
+		{
+			return false;
+		}
+
+		//- Set tres to the operand if it is a temporary
+		bool reuseTmp(tmp<Field<Type>>& tres) const
+		{
+			if (tf_.isTmp())
+			{
+				tres = tmp<Field<Type>>(tf_);
+				return true;
+			}
+
+			return false;
+		}
+
+
+		// Member Operators
+
+			//- Return element i
+		const Type& operator[](const label i) const
+		{
+			return tf_()[i];
+		}
+
+		//- Disallow assignment
+		void operator=(const tmpFieldExpression<Type>&) = delete;
+	};
+
+
+	/*---------------------------------------------------------------------------*\
+							   Class uniformFieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Expression of a uniform value
+	template<class Type>
+	class uniformFieldExpression
+		:
+		public FieldExpression<uniformFieldExpression<Type>>
+	{
+		// Private Data
+
+			//- The value
+		const Type value_;
+
+
+	public:
+
+		typedef Type value_type;
+
+
+		// Constructors
+
+			//- Construct from the value
+		explicit uniformFieldExpression(const Type& value)
+			:
+			value_(value)
+		{}
+
+
+		// Member Functions
+
+			//- Return -1, the value applies to any size
+		label size() const
+		{
+			return -1;
+		}
+
+		//- Return false, the value is not reusable
+		template<class TypeR>
+		bool reuseTmp(tmp<Field<TypeR>>&) const
+		{
+			return false;
+		}
+
+
+		// Member Operators
+
+			//- Return the value
+		const Type& operator[](const label) const
+		{
+			return value_;
+		}
+	};
+
+
+	/*---------------------------------------------------------------------------*\
+							   Class UnaryFieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Expression applying Op to the elements of E
+	template<class E, class Op>
+	class UnaryFieldExpression
+		:
+		public FieldExpression<UnaryFieldExpression<E, Op>>
+	{
+		// Private Data
+
+			//- The operand
+		E e_;
+
+
+	public:
+
+		typedef decltype
+		(
+			Op::apply(std::declval<typename E::value_type>())
+		) value_type;
+
+
+		// Constructors
+
+			//- Construct from the operand, moved in if a temporary
+		explicit UnaryFieldExpression(E e)
+			:
+			e_(std::move(e))
+		{}
+
+
+		// Member Functions
+
+			//- Return the size of the operand
+		label size() const
+		{
+			return e_.size();
+		}
+
+		//- Set tres to a temporary operand of the result type if present
+		template<class TypeR>
+		bool reuseTmp(tmp<Field<TypeR>>& tres) const
+		{
+			return e_.reuseTmp(tres);
+		}
+
+
+		// Member Operators
+
+			//- Return element i
+		value_type operator[](const label i) const
+		{
+			return Op::apply(e_[i]);
+		}
+	};
+
+
+	/*---------------------------------------------------------------------------*\
+							   Class BinaryFieldExpression Declaration
+	\*---------------------------------------------------------------------------*/
+
+	//- Expression applying Op to the elements of E1 and E2
+	template<class E1, class E2, class Op>
+	class BinaryFieldExpression
+		:
+		public FieldExpression<BinaryFieldExpression<E1, E2, Op>>
+	{
+		// Private Data
+
+			//- The first operand
+		E1 e1_;
+
+		//- The second operand
+		E2 e2_;
+
+
+	public:
+
+		typedef decltype
+		(
+			Op::apply
+			(
+				std::declval<typename E1::value_type>(),
+				std::declval<typename E2::value_type>()
+			)
+		) value_type;
+
+
+		// Constructors
+
+			//- Construct from the operands, moved in if temporaries
+		BinaryFieldExpression(E1 e1, E2 e2)
+			:
+			e1_(std::move(e1)),
+			e2_(std::move(e2))
+		{}
+
+
+		// Member Functions
+
+			//- Return the size of the operands
+		label size() const
+		{
+			return e1_.size() >= 0 ? e1_.size() : e2_.size();
+		}
+
+		//- Set tres to a temporary operand of the result type if present
+		template<class TypeR>
+		bool reuseTmp(tmp<Field<TypeR>>& tres) const
+		{
+			return e1_.reuseTmp(tres) || e2_.reuseTmp(tres);
+		}
+
+
+		// Member Operators
+
+			//- Return element i
+		value_type operator[](const label i) const
+		{
+			return Op::apply(e1_[i], e2_[i]);
+		}
+	};
+
+
+	// * * * * * * * * * * * * * * * * * Operations  * * * * * * * * * * * * * * //
+
+	namespace FieldExpressionOps
+	{
+
+#define FieldExpressionUnaryOp(OpName, Op)                                     \
+                                                                               \
+		struct OpName                                                          \
+		{                                                                      \
+			template<class Type>                                               \
+			static auto apply(const Type& a) -> decltype(Op a)                 \
+			{                                                                  \
+				return Op a;                                                   \
+			}                                                                  \
+		};
+
+#define FieldExpressionBinaryOp(OpName, Op)                                    \
+                                                                               \
+		struct OpName                                                          \
+		{                                                                      \
+			template<class Type1, class Type2>                                 \
+			static auto apply(const Type1& a, const Type2& b)                  \
+				-> decltype(a Op b)                                            \
+			{                                                                  \
+				return a Op b;                                                 \
+			}                                                                  \
+		};
+
+#define FieldExpressionUnaryFunc(Name)                                         \
+                                                                               \
+		struct Name##Func                                                      \
+		{                                                                      \
+			template<class Type>                                               \
+			static auto apply(const Type& a) -> decltype(Name(a))              \
+			{                                                                  \
+				return Name(a);                                                \
+			}                                                                  \
+		};
+
+#define FieldExpressionBinaryFunc(Name)                                        \
+                                                                               \
+		struct Name##Func                                                      \
+		{                                                                      \
+			template<class Type1, class Type2>                                 \
+			static auto apply(const Type1& a, const Type2& b)                  \
+				-> decltype(Name(a, b))                                        \
+			{                                                                  \
+				return Name(a, b);                                             \
+			}                                                                  \
+		};
+
+		FieldExpressionUnaryOp(negate, -)
+
+		FieldExpressionBinaryOp(add, +)
+		FieldExpressionBinaryOp(subtract, -)
+		FieldExpressionBinaryOp(multiply, *)
+		FieldExpressionBinaryOp(divide, /)
+		FieldExpressionBinaryOp(dot, &)
+
+		FieldExpressionUnaryFunc(mag)
+		FieldExpressionUnaryFunc(magSqr)
+		FieldExpressionUnaryFunc(sqr)
+		FieldExpressionUnaryFunc(sqrt)
+		FieldExpressionUnaryFunc(exp)
+		FieldExpressionUnaryFunc(log)
+
+		FieldExpressionBinaryFunc(max)
+		FieldExpressionBinaryFunc(min)
+
+#undef FieldExpressionUnaryOp
+#undef FieldExpressionBinaryOp
+#undef FieldExpressionUnaryFunc
+#undef FieldExpressionBinaryFunc
+
+	} // End namespace FieldExpressionOps
+
+
+	// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+	//- Start an expression with a Field or UList operand
+	template<class Type>
+	inline UListFieldExpression<Type> fieldExpr(const UList<Type>& list)
+	{
+		return UListFieldExpression<Type>(list);
+	}
+
+	//- Start an expression with a tmp<Field> operand
+	template<class Type>
+	inline tmpFieldExpression<Type> fieldExpr(const tmp<Field<Type>>& tf)
+	{
+		return tmpFieldExpression<Type>(tf);
+	}
+
+	//- Start an expression with a uniform value
+	template<class Type>
+	inline uniformFieldExpression<Type> uniformFieldExpr(const Type& value)
+	{
+		return uniformFieldExpression<Type>(value);
+	}
+
+	//- Evaluate the expression into a new temporary field, leaving its
+	//  operands unchanged
+	template<class Expr>
+	tmp<Field<typename Expr::value_type>> evaluate
+	(
+		const FieldExpression<Expr>& expr
+	)
+	{
+		typedef typename Expr::value_type Type;
+
+		tmp<Field<Type>> tres(new Field<Type>(expr().size()));
+
+		tres.ref() = expr;
+
+		return tres;
+	}
+
+	//- Evaluate the temporary expression into the storage of its first
+	//  temporary operand of the result type if present, otherwise into a
+	//  new temporary field
+	template<class Expr>
+	tmp<Field<typename Expr::value_type>> evaluate
+	(
+		FieldExpression<Expr>&& expr
+	)
+	{
+		typedef typename Expr::value_type Type;
+
+		tmp<Field<Type>> tres;
+
+		if (!expr().reuseTmp(tres))
+		{
+			tres = tmp<Field<Type>>(new Field<Type>(expr().size()));
+		}
+
+		tres.ref() = expr;
+
+		return tres;
+	}
+
+
+	// * * * * * * * * * * * * * * * Global Operators  * * * * * * * * * * * * * //
+
+#define FieldExpressionUnaryFunction(Func, Op)                                 \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E,                                                               \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline UnaryFieldExpression                                                \
+	<                                                                          \
+		typename std::decay<E>::type,                                          \
+		FieldExpressionOps::Op                                                 \
+	> Func(E&& e)                                                              \
+	{                                                                          \
+		return UnaryFieldExpression                                            \
+		<                                                                      \
+			typename std::decay<E>::type,                                      \
+			FieldExpressionOps::Op                                             \
+		>(std::forward<E>(e));                                                 \
+	}
+
+#define FieldExpressionBinaryFunction(Func, Op)                                \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E1,                                                              \
+		class E2,                                                              \
+		class = typename std::enable_if                                        \
+		<                                                                      \
+			isFieldExpression<E1>::value && isFieldExpression<E2>::value       \
+		>::type                                                                \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		typename std::decay<E1>::type,                                         \
+		typename std::decay<E2>::type,                                         \
+		FieldExpressionOps::Op                                                 \
+	> Func(E1&& e1, E2&& e2)                                                   \
+	{                                                                          \
+		return BinaryFieldExpression                                           \
+		<                                                                      \
+			typename std::decay<E1>::type,                                     \
+			typename std::decay<E2>::type,                                     \
+			FieldExpressionOps::Op                                             \
+		>(std::forward<E1>(e1), std::forward<E2>(e2));                         \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E,                                                               \
+		class Type,                                                            \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		typename std::decay<E>::type,                                          \
+		UListFieldExpression<Type>,                                            \
+		FieldExpressionOps::Op                                                 \
+	> Func(E&& e, const UList<Type>& list)                                     \
+	{                                                                          \
+		return Func(std::forward<E>(e), fieldExpr(list));                      \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class Type,                                                            \
+		class E,                                                               \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		UListFieldExpression<Type>,                                            \
+		typename std::decay<E>::type,                                          \
+		FieldExpressionOps::Op                                                 \
+	> Func(const UList<Type>& list, E&& e)                                     \
+	{                                                                          \
+		return Func(fieldExpr(list), std::forward<E>(e));                      \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E,                                                               \
+		class Type,                                                            \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		typename std::decay<E>::type,                                          \
+		tmpFieldExpression<Type>,                                              \
+		FieldExpressionOps::Op                                                 \
+	> Func(E&& e, const tmp<Field<Type>>& tf)                                  \
+	{                                                                          \
+		return Func(std::forward<E>(e), fieldExpr(tf));                        \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class Type,                                                            \
+		class E,                                                               \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		tmpFieldExpression<Type>,                                              \
+		typename std::decay<E>::type,                                          \
+		FieldExpressionOps::Op                                                 \
+	> Func(const tmp<Field<Type>>& tf, E&& e)                                  \
+	{                                                                          \
+		return Func(fieldExpr(tf), std::forward<E>(e));                        \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E,                                                               \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		typename std::decay<E>::type,                                          \
+		uniformFieldExpression<scalar>,                                        \
+		FieldExpressionOps::Op                                                 \
+	> Func(E&& e, const scalar& s)                                             \
+	{                                                                          \
+		return Func(std::forward<E>(e), uniformFieldExpr(s));                  \
+	}                                                                          \
+                                                                               \
+	template                                                                   \
+	<                                                                          \
+		class E,                                                               \
+		class = typename std::enable_if<isFieldExpression<E>::value>::type     \
+	>                                                                          \
+	inline BinaryFieldExpression                                               \
+	<                                                                          \
+		uniformFieldExpression<scalar>,                                        \
+		typename std::decay<E>::type,                                          \
+		FieldExpressionOps::Op                                                 \
+	> Func(const scalar& s, E&& e)                                             \
+	{                                                                          \
+		return Func(uniformFieldExpr(s), std::forward<E>(e));                  \
+	}
+
+	FieldExpressionUnaryFunction(operator-, negate)
+	FieldExpressionUnaryFunction(mag, magFunc)
+	FieldExpressionUnaryFunction(magSqr, magSqrFunc)
+	FieldExpressionUnaryFunction(sqr, sqrFunc)
+	FieldExpressionUnaryFunction(sqrt, sqrtFunc)
+	FieldExpressionUnaryFunction(exp, expFunc)
+	FieldExpressionUnaryFunction(log, logFunc)
+
+	FieldExpressionBinaryFunction(operator+, add)
+	FieldExpressionBinaryFunction(operator-, subtract)
+	FieldExpressionBinaryFunction(operator*, multiply)
+	FieldExpressionBinaryFunction(operator/, divide)
+	FieldExpressionBinaryFunction(operator&, dot)
+	FieldExpressionBinaryFunction(max, maxFunc)
+	FieldExpressionBinaryFunction(min, minFunc)
+
+#undef FieldExpressionUnaryFunction
+#undef FieldExpressionBinaryFunction
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_FieldExpression_Header
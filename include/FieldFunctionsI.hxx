@@ -413,6 +413,13 @@ namespace tnbLib
 	}
 
 
+	template<class Type>
+	void axpy(UList<Type>& y, const scalar a, const UList<Type>& x)
+	{
+		TFOR_ALL_F_OP_S_OP_F(Type, y, +=, scalar, a, *, Type, x)
+	}
+
+
 	template<class Type>
 	Type sumCmptProd(const UList<Type>& f1, const UList<Type>& f2)
 	{
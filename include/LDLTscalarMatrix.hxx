@@ -0,0 +1,279 @@
+#pragma once
+#ifndef _LDLTscalarMatrix_Header
+#define _LDLTscalarMatrix_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::LDLTscalarMatrix
+
+Description
+	Sparse LDL^T factorisation of a symmetric lduMatrix, used as direct
+	solver of the GAMG coarsest level.
+
+	In parallel the matrix is gathered to and factorised on the master of
+	the communicator of the matrix mesh, as for LUscalarMatrix.
+
+	The unknowns are reordered by nested dissection using level-structure
+	separators to reduce the fill-in. The symbolic factorisation (ordering,
+	elimination tree and structure of L) is computed by an up-looking
+	algorithm and is reused for as long as the matrix structure is
+	unchanged. The numeric factorisation is reused for as long as the
+	coefficients are unchanged.
+
+SourceFiles
+	LDLTscalarMatrix.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <labelList.hxx>
+#include <scalarField.hxx>
+#include <DynamicList.hxx>
+#include <FieldField.hxx>
+#include <lduInterfaceFieldPtrsList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	class lduMatrix;
+	class procLduMatrix;
+
+	/*---------------------------------------------------------------------------*\
+							  Class LDLTscalarMatrix Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class LDLTscalarMatrix
+	{
+		// Private Data
+
+			//- Communicator to use
+		label comm_;
+
+		//- Processor matrix offsets
+		labelList procOffsets_;
+
+		//- Number of rows of the gathered matrix
+		label n_;
+
+		//- Rows of the assembled lower-triangle entries
+		labelList entryRows_;
+
+		//- Columns of the assembled lower-triangle entries
+		labelList entryColumns_;
+
+		//- Values of the assembled lower-triangle entries
+		scalarField entryValues_;
+
+		//- Fill-reducing permutation: new to old row
+		labelList perm_;
+
+		//- Inverse permutation: old to new row
+		labelList iperm_;
+
+		//- Slot of each entry in the permuted upper-triangle columns
+		labelList entrySlots_;
+
+		//- Column starts of the permuted upper triangle
+		labelList Ap_;
+
+		//- Row indices of the permuted upper triangle
+		labelList Ai_;
+
+		//- Elimination tree
+		labelList parent_;
+
+		//- Column starts of L
+		labelList Lp_;
+
+		//- Row indices of L
+		labelList Li_;
+
+		//- Coefficients of L
+		scalarField Lx_;
+
+		//- Diagonal D
+		scalarField D_;
+
+
+		// Private Member Functions
+
+			//- Append the entry if it is in the lower triangle
+		FoamBase_EXPORT void append
+		(
+			DynamicList<label>& rows,
+			DynamicList<label>& columns,
+			DynamicList<scalar>& values,
+			const label row,
+			const label column,
+			const scalar value
+		) const;
+
+		//- Assemble the entries of the given lduMatrix
+		FoamBase_EXPORT void assemble
+		(
+			const lduMatrix& ldum,
+			const FieldField<Field, scalar>& interfaceCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			DynamicList<label>& rows,
+			DynamicList<label>& columns,
+			DynamicList<scalar>& values
+		);
+
+		//- Assemble the entries of the given list of procLduMatrix
+		//  on the master processor
+		FoamBase_EXPORT void assemble
+		(
+			const PtrList<procLduMatrix>& lduMatrices,
+			DynamicList<label>& rows,
+			DynamicList<label>& columns,
+			DynamicList<scalar>& values
+		);
+
+		//- Order the connected components of the given subset of rows
+		FoamBase_EXPORT void dissect
+		(
+			const labelList& adjStart,
+			const labelList& adj,
+			const labelList& subset,
+			labelList& mark,
+			label& stamp,
+			labelList& level,
+			DynamicList<label>& order
+		) const;
+
+		//- Order the given connected subset of rows by nested dissection
+		FoamBase_EXPORT void dissectConnected
+		(
+			const labelList& adjStart,
+			const labelList& adj,
+			const labelList& subset,
+			labelList& mark,
+			label& stamp,
+			labelList& level,
+			DynamicList<label>& order
+		) const;
+
+		//- Calculate the levels of the rows of the subset marked with stamp
+		//  reached from root. Returns the number of levels and the
+		//  reached rows in the order of their level.
+		FoamBase_EXPORT label levelStructure
+		(
+			const labelList& adjStart,
+			const labelList& adj,
+			const labelList& subset,
+			const label root,
+			const labelList& mark,
+			const label stamp,
+			labelList& level,
+			DynamicList<label>& reached
+		) const;
+
+		//- Calculate the fill-reducing ordering, elimination tree and
+		//  structure of L
+		FoamBase_EXPORT void symbolic();
+
+		//- Calculate the coefficients of L and D
+		FoamBase_EXPORT void numeric();
+
+		//- Solve L D L^T x = b in place on the master processor
+		FoamBase_EXPORT void backSubstitute(scalarField& x) const;
+
+
+	public:
+
+		// Declare name of the class and its debug switch
+		//ClassName("LDLTscalarMatrix");
+		static const char* typeName_() { return "LDLTscalarMatrix"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+
+
+		// Constructors
+
+			//- Construct null
+		FoamBase_EXPORT LDLTscalarMatrix();
+
+		//- Construct from lduMatrix and factorise
+		FoamBase_EXPORT LDLTscalarMatrix
+		(
+			const lduMatrix&,
+			const FieldField<Field, scalar>& interfaceCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces
+		);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT LDLTscalarMatrix(const LDLTscalarMatrix&) = delete;
+
+
+		// Member Functions
+
+			//- Return the number of rows of the gathered matrix
+		label n() const
+		{
+			return n_;
+		}
+
+		//- Return the number of coefficients of L
+		label nnzL() const
+		{
+			return Li_.size();
+		}
+
+		//- Factorise the given lduMatrix, reusing the symbolic factorisation
+		//  if the structure is unchanged and the numeric factorisation if
+		//  the coefficients are unchanged
+		FoamBase_EXPORT void factorise
+		(
+			const lduMatrix&,
+			const FieldField<Field, scalar>& interfaceCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces
+		);
+
+		//- Solve the linear system with the given source
+		//  and returning the solution in the Field argument x.
+		//  This function may be called with the same field for x and source.
+		FoamBase_EXPORT void solve
+		(
+			scalarField& x,
+			const scalarField& source
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const LDLTscalarMatrix&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_LDLTscalarMatrix_Header
@@ -1,12 +1,58 @@
 #pragma once
+#include <new>
+#include <type_traits>
+
 // * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
 
+template<class T>
+inline T* tnbLib::List<T>::newArray(const label n)
+{
+#ifdef USELISTPOOL
+	if (std::is_trivially_destructible<T>::value)
+	{
+		T* v = static_cast<T*>(listPool::allocate(n * sizeof(T)));
+
+		for (label i = 0; i < n; i++)
+		{
+			new(v + i) T;
+		}
+
+		return v;
+	}
+#endif
+
+	T* v = new T[n];
+
+	if (firstTouch::active(n*sizeof(T)))
+	{
+		firstTouch::touch(v, n*sizeof(T));
+	}
+
+	return v;
+}
+
+
+template<class T>
+inline void tnbLib::List<T>::deleteArray(T* v)
+{
+#ifdef USELISTPOOL
+	if (std::is_trivially_destructible<T>::value)
+	{
+		listPool::deallocate(v);
+		return;
+	}
+#endif
+
+	delete[] v;
+}
+
+
 template<class T>
 inline void tnbLib::List<T>::alloc()
 {
 	if (this->size_ > 0)
 	{
-		this->v_ = new T[this->size_];
+		this->v_ = newArray(this->size_);
 	}
 }
 
@@ -101,7 +147,7 @@ inline void tnbLib::List<T>::clear()
 {
 	if (this->v_)
 	{
-		delete[] this->v_;
+		deleteArray(this->v_);
 		this->v_ = 0;
 	}
 
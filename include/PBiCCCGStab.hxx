@@ -0,0 +1,140 @@
+#pragma once
+#ifndef _PBiCCCGStab_Header
+#define _PBiCCCGStab_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::PBiCCCGStab
+
+Description
+	Preconditioned bi-conjugate gradient stabilised solver for symmetric and
+	asymmetric LduMatrices of coupled components using a run-time selectable
+	preconditioner.
+
+	The components of the field are solved in a single Krylov space, the
+	inner products summing over all the components, so that components
+	coupled through the interfaces or the coefficients converge together.
+	Unlike PBiCCCG the transpose of the matrix is not required.
+
+	Selected for vector and tensor equations by
+	\verbatim
+		U
+		{
+			type            coupled;
+			solver          PBiCCCGStab;
+			preconditioner  DILU;
+			tolerance       (1e-6 1e-6 1e-6);
+			relTol          (0.1 0.1 0.1);
+		}
+	\endverbatim
+
+	References:
+	\verbatim
+		Van der Vorst, H. A. (1992).
+		Bi-CGSTAB: A fast and smoothly converging variant of Bi-CG
+		for the solution of nonsymmetric linear systems.
+		SIAM Journal on scientific and Statistical Computing, 13(2), 631-644.
+	\endverbatim
+
+SourceFiles
+	PBiCCCGStab.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <LduMatrixTemplate.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class PBiCCCGStab Declaration
+	\*---------------------------------------------------------------------------*/
+
+	template<class Type, class DType, class LUType>
+	class PBiCCCGStab
+		:
+		public LduMatrix<Type, DType, LUType>::solver
+	{
+
+	public:
+
+		//- Runtime type information
+		//TypeName("PBiCCCGStab");
+		static const char* typeName_() { return "PBiCCCGStab"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct from matrix components and solver data dictionary
+		PBiCCCGStab
+		(
+			const word& fieldName,
+			const LduMatrix<Type, DType, LUType>& matrix,
+			const dictionary& solverDict
+		);
+
+		//- Disallow default bitwise copy construction
+		PBiCCCGStab(const PBiCCCGStab&) = delete;
+
+
+		// Destructor
+
+		virtual ~PBiCCCGStab()
+		{}
+
+
+		// Member Functions
+
+			//- Solve the matrix with this solver
+		virtual SolverPerformance<Type> solve(Field<Type>& psi) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		void operator=(const PBiCCCGStab&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <PBiCCCGStabI.hxx>
+
+//#ifdef NoRepository
+//#include <PBiCCCGStab.cxx>
+//#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_PBiCCCGStab_Header
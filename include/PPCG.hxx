@@ -0,0 +1,153 @@
+#pragma once
+#ifndef _PPCG_Header
+#define _PPCG_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::PPCG
+
+Description
+	Pipelined preconditioned conjugate gradient solver for symmetric
+	lduMatrices using a run-time selectable preconditioner.
+
+	The two inner products and the residual norm of each iteration are
+	combined into a single non-blocking reduction which is completed after
+	the preconditioning and matrix multiplication of the next search
+	direction, hiding the latency of the global synchronisation. Compared
+	with PCG this requires four additional work fields and one additional
+	preconditioning and matrix multiplication per solve.
+
+	References:
+	\verbatim
+		Ghysels, P., & Vanroose, W. (2014).
+		Hiding global synchronization latency in the preconditioned
+		Conjugate Gradient algorithm.
+		Parallel Computing, 40(7), 224-238.
+	\endverbatim
+
+Usage
+	\verbatim
+	p
+	{
+		solver          PPCG;
+		preconditioner  DIC;
+		tolerance       1e-06;
+		relTol          0.05;
+	}
+	\endverbatim
+
+SourceFiles
+	PPCG.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <lduMatrix.hxx>
+#include <FixedList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class PPCG Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class PPCG
+		:
+		public lduMatrix::solver
+	{
+		// Private Member Functions
+
+			//- Start the non-blocking reduction of sumProd(a, b),
+			//  sumProd(a, c) and sumMag(d). Sets requestID.
+		FoamBase_EXPORT void gSumMagProd
+		(
+			FixedList<scalar, 3>& globalSum,
+			const scalarField& a,
+			const scalarField& b,
+			const scalarField& c,
+			const scalarField& d,
+			label& requestID
+		) const;
+
+
+	public:
+
+		//- Runtime type information
+		//TypeName("PPCG");
+		static const char* typeName_() { return "PPCG"; }
+		static FoamBase_EXPORT const ::tnbLib::word typeName;
+		static FoamBase_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct from matrix components and solver controls
+		FoamBase_EXPORT PPCG
+		(
+			const word& fieldName,
+			const lduMatrix& matrix,
+			const FieldField<Field, scalar>& interfaceBouCoeffs,
+			const FieldField<Field, scalar>& interfaceIntCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			const dictionary& solverControls
+		);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT PPCG(const PPCG&) = delete;
+
+
+		//- Destructor
+		virtual ~PPCG()
+		{}
+
+
+		// Member Functions
+
+			//- Solve the matrix with this solver
+		FoamBase_EXPORT virtual solverPerformance solve
+		(
+			scalarField& psi,
+			const scalarField& source,
+			const direction cmpt = 0
+		) const;
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const PPCG&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_PPCG_Header
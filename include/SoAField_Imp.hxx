@@ -0,0 +1,241 @@
+#pragma once
+#include <simdPack.hxx>
+#include <simdFields.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::SoAField<Type>::SoAField(const UList<Type>& f)
+{
+	gather(f);
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+void tnbLib::SoAField<Type>::setSize(const label size)
+{
+	forAll(components_, d)
+	{
+		components_[d].setSize(size);
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::gather(const UList<Type>& f)
+{
+	setSize(f.size());
+
+	const label n = f.size();
+	const scalar* fp = reinterpret_cast<const scalar*>(f.cdata());
+
+	scalar* cp[nComponents];
+	forAll(components_, d)
+	{
+		cp[d] = components_[d].begin();
+	}
+
+	// Transpose pairs of elements into component packs
+	simdPack c[nComponents];
+
+	label i = 0;
+
+	for (; i + 1 < n; i += 2)
+	{
+		simdPack::deinterleave<nComponents>(fp + nComponents * i, c);
+
+		for (direction d = 0; d < nComponents; d++)
+		{
+			c[d].store(cp[d] + i);
+		}
+	}
+
+	for (; i < n; i++)
+	{
+		for (direction d = 0; d < nComponents; d++)
+		{
+			cp[d][i] = fp[nComponents*i + d];
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::scatter(UList<Type>& f) const
+{
+	if (f.size() != size())
+	{
+		FatalErrorInFunction
+			<< "Size of field " << f.size()
+			<< " differs from the size of the components " << size()
+			<< abort(FatalError);
+	}
+
+	const label n = f.size();
+	scalar* fp = reinterpret_cast<scalar*>(f.data());
+
+	const scalar* cp[nComponents];
+	forAll(components_, d)
+	{
+		cp[d] = components_[d].cdata();
+	}
+
+	simdPack c[nComponents];
+
+	label i = 0;
+
+	for (; i + 1 < n; i += 2)
+	{
+		for (direction d = 0; d < nComponents; d++)
+		{
+			c[d] = simdPack::load(cp[d] + i);
+		}
+
+		simdPack::interleave<nComponents>(c, fp + nComponents * i);
+	}
+
+	for (; i < n; i++)
+	{
+		for (direction d = 0; d < nComponents; d++)
+		{
+			fp[nComponents*i + d] = cp[d][i];
+		}
+	}
+}
+
+
+template<class Type>
+tnbLib::tmp<tnbLib::Field<Type>> tnbLib::SoAField<Type>::field() const
+{
+	tmp<Field<Type>> tf(new Field<Type>(size()));
+	scatter(tf.ref());
+	return tf;
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::axpy(const scalar a, const SoAField<Type>& x)
+{
+	forAll(components_, d)
+	{
+		tnbLib::axpy(components_[d], a, x.components_[d]);
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Member Operators  * * * * * * * * * * * * * //
+
+template<class Type>
+void tnbLib::SoAField<Type>::operator=(const Type& t)
+{
+	forAll(components_, d)
+	{
+		components_[d] = tnbLib::component(t, d);
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::operator+=(const SoAField<Type>& f)
+{
+	forAll(components_, d)
+	{
+		components_[d] += f.components_[d];
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::operator-=(const SoAField<Type>& f)
+{
+	forAll(components_, d)
+	{
+		components_[d] -= f.components_[d];
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::operator*=(const UList<scalar>& s)
+{
+	forAll(components_, d)
+	{
+		components_[d] *= s;
+	}
+}
+
+
+template<class Type>
+void tnbLib::SoAField<Type>::operator*=(const scalar s)
+{
+	forAll(components_, d)
+	{
+		components_[d] *= s;
+	}
+}
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::scalar tnbLib::sumProd
+(
+	const SoAField<Type>& f1,
+	const SoAField<Type>& f2
+)
+{
+	scalar s = 0;
+
+	for (direction d = 0; d < SoAField<Type>::nComponents; d++)
+	{
+		s += sumProd(f1.component(d), f2.component(d));
+	}
+
+	return s;
+}
+
+
+template<class Type>
+void tnbLib::dot
+(
+	scalarField& res,
+	const SoAField<Type>& f1,
+	const SoAField<Type>& f2
+)
+{
+	res.setSize(f1.size());
+
+	// Accumulate component by component in the order of operator&&
+	scalar* __restrict resP = res.begin();
+
+	const scalar* __restrict f1P = f1.component(0).cdata();
+	const scalar* __restrict f2P = f2.component(0).cdata();
+
+	forAll(res, i)
+	{
+		resP[i] = f1P[i] * f2P[i];
+	}
+
+	for (direction d = 1; d < SoAField<Type>::nComponents; d++)
+	{
+		f1P = f1.component(d).cdata();
+		f2P = f2.component(d).cdata();
+
+		forAll(res, i)
+		{
+			resP[i] += f1P[i] * f2P[i];
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::magSqr(scalarField& res, const SoAField<Type>& f)
+{
+	dot(res, f, f);
+}
+
+
+// ************************************************************************* //
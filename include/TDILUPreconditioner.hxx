@@ -35,6 +35,9 @@ Description
 	The inverse (reciprocal for scalar) of the preconditioned diagonal is
 	calculated and stored.
 
+	For symmetric matrices the lower coefficients are the upper and the
+	preconditioner reduces to the diagonal incomplete Cholesky (DIC).
+
 SourceFiles
 	TDILUPreconditioner.C
 
@@ -137,6 +137,35 @@ namespace tnbLib
 			const label communicator = 0
 		);
 
+		//- Start a non-blocking read into the given buffer from the given
+		//  processor on a persistent channel, set to -1 initially. The
+		//  channel is created on the first read and re-created if the
+		//  buffer, its size or the source change. Falls back to a
+		//  non-blocking read unless UPstream::persistentRequests is set.
+		static FoamBase_EXPORT label read
+		(
+			label& channel,
+			const int fromProcNo,
+			char* buf,
+			const std::streamsize bufSize,
+			const int tag = UPstream::msgType(),
+			const label communicator = 0
+		);
+
+		//- Copy the next message written by UOPstream::writeShared from the
+		//  given processor into the given buffer, waiting for it to be
+		//  written. Returns false if the processor is not a
+		//  UPstream::sharedMemoryPeer or if the message has been sent by
+		//  MPI, in which case nothing is read
+		static FoamBase_EXPORT bool readShared
+		(
+			const int fromProcNo,
+			char* buf,
+			const std::streamsize bufSize,
+			const int tag = UPstream::msgType(),
+			const label communicator = 0
+		);
+
 		//- Return next token from stream
 		FoamBase_EXPORT Istream& read(token&);
 
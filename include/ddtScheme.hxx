@@ -251,6 +251,22 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>& vf
 			) = 0;
 
+			//- Add fvmDdt(vf) to the given matrix in place.
+			//  The default implementation assembles the term separately
+			virtual void addFvmDdt
+			(
+				fvMatrix<Type>&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
+			//- Add fvmDdt(rho, vf) to the given matrix in place
+			virtual void addFvmDdt
+			(
+				fvMatrix<Type>&,
+				const volScalarField&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
 			typedef GeometricField
 				<
 				typename flux<Type>::type,
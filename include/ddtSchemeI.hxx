@@ -108,6 +108,29 @@ namespace tnbLib
 		}
 
 
+		template<class Type>
+		void ddtScheme<Type>::addFvmDdt
+		(
+			fvMatrix<Type>& fvm,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			fvm += fvmDdt(vf);
+		}
+
+
+		template<class Type>
+		void ddtScheme<Type>::addFvmDdt
+		(
+			fvMatrix<Type>& fvm,
+			const volScalarField& rho,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			fvm += fvmDdt(rho, vf);
+		}
+
+
 		template<class Type>
 		tmp<GeometricField<Type, fvsPatchField, surfaceMesh>> ddtScheme<Type>::fvcDdt
 		(
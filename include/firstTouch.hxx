@@ -0,0 +1,161 @@
+#pragma once
+#ifndef _firstTouch_Header
+#define _firstTouch_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::firstTouch
+
+Description
+	NUMA-aware first-touch placement of the storage of large Lists.
+
+	On Linux (and most other systems) a page of memory is placed on the
+	NUMA node of the thread which first writes to it. When the storage of
+	the mesh and field arrays is initialised by the master thread all the
+	pages land on its node and the worker threads of threadPool access
+	them remotely.
+
+	With the "numaFirstTouch" optimisation switch set, e.g. in the
+	OptimisationSwitches of the case controlDict,
+	\verbatim
+		OptimisationSwitches
+		{
+			nThreads        8;
+			numaFirstTouch  1;
+		}
+	\endverbatim
+	the storage of every List of at least minBytes bytes is touched by the
+	threads of the global threadPool as soon as it is allocated, thread i
+	touching the i-th of nThreads equal parts. This covers the cell and
+	face arrays of primitiveMesh, the fvMesh geometry and the internal
+	fields of the GeometricFields. The thread partition is then fixed to
+	the same equal parts:
+	  - threadPool executes task i of a loop on thread i modulo nThreads,
+	  - lduAddressing splits the equations into nThreads blocks of equal
+		size,
+	so that each thread works on the pages it placed. The touch reads and
+	writes back a byte of each page and so preserves the contents.
+
+	Threads are not pinned, the processes should be bound to NUMA nodes
+	or sockets by the MPI launcher (e.g. mpirun --bind-to socket) so that
+	the threads of a rank stay on the node they placed their pages on.
+
+	With numaFirstTouch 2 the node of the pages of each part of the main
+	mesh arrays is reported when the fvMesh is constructed. The report
+	uses the Linux move_pages system call and is not available on other
+	systems.
+
+SourceFiles
+	firstTouch.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <label.hxx>
+
+#include <cstddef>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class Ostream;
+	template<class T> class UList;
+	template<class T> class List;
+
+	/*---------------------------------------------------------------------------*\
+							   Class firstTouch Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class firstTouch
+	{
+	public:
+
+		// Static Data
+
+			//- NUMA first-touch placement switch (optimisation switch):
+			//  0 off, 1 on, 2 on and report the page placement
+		static FoamBase_EXPORT int numaFirstTouch;
+
+		//- Minimum size in bytes of the storage placed by the threads
+		static FoamBase_EXPORT const size_t minBytes;
+
+		//- Page size assumed for the touch
+		static FoamBase_EXPORT const size_t pageSize;
+
+
+		// Static Member Functions
+
+			//- Return true if storage of the given size is to be placed
+		inline static bool active(const size_t nBytes)
+		{
+			return numaFirstTouch && nBytes >= minBytes;
+		}
+
+		//- Touch the pages of the given storage, part i by thread i
+		static FoamBase_EXPORT void touch(void* p, const size_t nBytes);
+
+		//- Return the NUMA node of each page of the given storage,
+		//  -1 if unknown
+		static FoamBase_EXPORT List<label> pageNodes
+		(
+			const void* p,
+			const size_t nBytes
+		);
+
+		//- Write the NUMA nodes of the pages of each thread part of the
+		//  given storage
+		static FoamBase_EXPORT void writePlacement
+		(
+			Ostream& os,
+			const char* name,
+			const void* p,
+			const size_t nBytes
+		);
+
+		//- Write the NUMA nodes of the pages of each thread part of the
+		//  given list
+		template<class T>
+		static void writePlacement
+		(
+			Ostream& os,
+			const char* name,
+			const UList<T>& l
+		)
+		{
+			writePlacement(os, name, l.cdata(), l.size()*sizeof(T));
+		}
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_firstTouch_Header
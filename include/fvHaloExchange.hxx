@@ -0,0 +1,262 @@
+#pragma once
+#ifndef _fvHaloExchange_Header
+#define _fvHaloExchange_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::fvHaloExchange
+
+Description
+	Aggregated exchange of the processor patch values of several fields.
+
+	The boundary conditions of the fields added to the exchange are
+	corrected together. The processor patch values of all the fields are
+	packed per neighbouring processor and exchanged in a single
+	neighbourhood collective (MPI_Neighbor_alltoallv) instead of one
+	message per processor patch and field. The other patches are evaluated
+	as by GeometricField::correctBoundaryConditions.
+
+	The neighbourhood communicator is built once per mesh from the
+	processor topology of the mesh (globalMeshData) and is rebuilt after
+	topology changes. Multiple processor patches between two processors,
+	e.g. processorCyclic patches, are ordered by their message tag.
+
+	All processors must add the same fields in the same order. If not
+	running in parallel the fields are corrected one after the other.
+
+	\verbatim
+		fvHaloExchange& halo = fvHaloExchange::New(mesh);
+
+		halo.add(U);
+		halo.add(p);
+		halo.add(k);
+		halo.correctBoundaryConditions();
+	\endverbatim
+
+SourceFiles
+	fvHaloExchange.cxx
+	fvHaloExchangeI.hxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <MeshObject.hxx>
+#include <fvMesh.hxx>
+#include <volFieldsFwd.hxx>
+#include <PtrList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							Class fvHaloExchange Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class fvHaloExchange
+		:
+		public MeshObject<fvMesh, TopologicalMeshObject, fvHaloExchange>
+	{
+		// Private Classes
+
+			//- Field added to the exchange
+		class haloField
+		{
+		public:
+
+			//- Destructor
+			virtual ~haloField()
+			{}
+
+			//- Return the number of bytes exchanged over the given patch
+			virtual label byteSize(const label patchi) const = 0;
+
+			//- Initialise the evaluation of the non-processor patches
+			virtual void initEvaluate(const Pstream::commsTypes) = 0;
+
+			//- Copy the patch internal values of the given processor patch
+			//  into the buffer
+			virtual void pack(const label patchi, char* buf) const = 0;
+
+			//- Evaluate the given processor patch from the patch internal
+			//  values of the neighbour in the buffer
+			virtual void unpack(const label patchi, const char* buf) = 0;
+
+			//- Evaluate the non-processor patches
+			virtual void evaluate(const Pstream::commsTypes) = 0;
+		};
+
+		//- Field of the given type added to the exchange
+		template<class Type>
+		class haloFieldType
+			:
+			public haloField
+		{
+			// Private Data
+
+				//- The field
+			GeometricField<Type, fvPatchField, volMesh>& vf_;
+
+			//- Is the patch a processor patch
+			const boolList& procPatch_;
+
+
+		public:
+
+			// Constructors
+
+				//- Construct from the field and the processor patch flags
+			haloFieldType
+			(
+				GeometricField<Type, fvPatchField, volMesh>& vf,
+				const boolList& procPatch
+			);
+
+
+			// Member Functions
+
+				//- Return the number of bytes exchanged over the given patch
+			virtual label byteSize(const label patchi) const;
+
+			//- Initialise the evaluation of the non-processor patches
+			virtual void initEvaluate(const Pstream::commsTypes);
+
+			//- Copy the patch internal values of the given processor patch
+			//  into the buffer
+			virtual void pack(const label patchi, char* buf) const;
+
+			//- Evaluate the given processor patch from the patch internal
+			//  values of the neighbour in the buffer
+			virtual void unpack(const label patchi, const char* buf);
+
+			//- Evaluate the non-processor patches
+			virtual void evaluate(const Pstream::commsTypes);
+		};
+
+
+		// Private Data
+
+			//- Neighbourhood communicator, -1 if not running in parallel
+		label comm_;
+
+		//- Neighbouring processors in the order of the communicator
+		labelList neighbProcs_;
+
+		//- Processor patches per neighbouring processor ordered by tag
+		labelListList procPatches_;
+
+		//- Is the patch a processor patch
+		boolList isProcPatch_;
+
+		//- Fields added to the exchange
+		PtrList<haloField> fields_;
+
+		//- Number of bytes exchanged per neighbouring processor
+		List<int> sizes_;
+
+		//- Offsets of the neighbouring processors in the buffers
+		List<int> offsets_;
+
+		//- Send buffer
+		List<char> sendBuf_;
+
+		//- Receive buffer
+		List<char> recvBuf_;
+
+
+		// Private Member Functions
+
+			//- Return the number of bytes rounded up to keep the values in
+			//  the buffers aligned
+		static label alignedSize(const label nBytes);
+
+		//- Set the neighbouring processors and their processor patches and
+		//  allocate the neighbourhood communicator
+		void calcNeighbours();
+
+
+	public:
+
+		// Declare name of the class and its debug switch
+		/*TypeName("fvHaloExchange");*/
+		static const char* typeName_() { return "fvHaloExchange"; }
+		static FoamFiniteVolume_EXPORT const ::tnbLib::word typeName;
+		static FoamFiniteVolume_EXPORT int debug;
+		virtual const word& type() const { return typeName; };
+
+
+		// Constructors
+
+			//- Construct given an fvMesh
+		FoamFiniteVolume_EXPORT explicit fvHaloExchange(const fvMesh&);
+
+
+		//- Destructor
+		FoamFiniteVolume_EXPORT virtual ~fvHaloExchange();
+
+
+		// Static Member Functions
+
+			//- Return the exchange of the given mesh, constructing it if
+			//  necessary
+		static FoamFiniteVolume_EXPORT fvHaloExchange& New(const fvMesh&);
+
+
+		// Member Functions
+
+			//- Return the neighbouring processors
+		const labelList& neighbProcs() const
+		{
+			return neighbProcs_;
+		}
+
+		//- Return the number of fields added to the exchange
+		label nFields() const
+		{
+			return fields_.size();
+		}
+
+		//- Add a field to the next exchange
+		template<class Type>
+		void add(GeometricField<Type, fvPatchField, volMesh>&);
+
+		//- Correct the boundary conditions of the added fields, exchanging
+		//  the processor patch values in a single collective, and clear
+		//  the list of fields
+		FoamFiniteVolume_EXPORT void correctBoundaryConditions();
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <fvHaloExchangeI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_fvHaloExchange_Header
@@ -0,0 +1,129 @@
+#pragma once
+#include <volFields.hxx>
+#include <processorFvPatchField.hxx>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::fvHaloExchange::haloFieldType<Type>::haloFieldType
+(
+	GeometricField<Type, fvPatchField, volMesh>& vf,
+	const boolList& procPatch
+)
+	:
+	vf_(vf),
+	procPatch_(procPatch)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+tnbLib::label tnbLib::fvHaloExchange::haloFieldType<Type>::byteSize
+(
+	const label patchi
+) const
+{
+	return vf_.boundaryField()[patchi].size()*sizeof(Type);
+}
+
+
+template<class Type>
+void tnbLib::fvHaloExchange::haloFieldType<Type>::initEvaluate
+(
+	const Pstream::commsTypes commsType
+)
+{
+	vf_.setUpToDate();
+	vf_.storeOldTimes();
+
+	typename GeometricField<Type, fvPatchField, volMesh>::Boundary& bf =
+		vf_.boundaryFieldRef();
+
+	forAll(bf, patchi)
+	{
+		if (!procPatch_[patchi])
+		{
+			bf[patchi].initEvaluate(commsType);
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::fvHaloExchange::haloFieldType<Type>::pack
+(
+	const label patchi,
+	char* buf
+) const
+{
+	const Field<Type>& iF = vf_.primitiveField();
+	const labelUList& faceCells = vf_.mesh().boundary()[patchi].faceCells();
+
+	Type* values = reinterpret_cast<Type*>(buf);
+
+	forAll(faceCells, facei)
+	{
+		values[facei] = iF[faceCells[facei]];
+	}
+}
+
+
+template<class Type>
+void tnbLib::fvHaloExchange::haloFieldType<Type>::unpack
+(
+	const label patchi,
+	const char* buf
+)
+{
+	fvPatchField<Type>& pf = vf_.boundaryFieldRef()[patchi];
+
+	refCast<processorFvPatchField<Type>>(pf).evaluate
+	(
+		UList<Type>
+		(
+			reinterpret_cast<Type*>(const_cast<char*>(buf)),
+			pf.size()
+		)
+	);
+}
+
+
+template<class Type>
+void tnbLib::fvHaloExchange::haloFieldType<Type>::evaluate
+(
+	const Pstream::commsTypes commsType
+)
+{
+	typename GeometricField<Type, fvPatchField, volMesh>::Boundary& bf =
+		vf_.boundaryFieldRef();
+
+	forAll(bf, patchi)
+	{
+		if (!procPatch_[patchi])
+		{
+			bf[patchi].evaluate(commsType);
+		}
+	}
+}
+
+
+template<class Type>
+void tnbLib::fvHaloExchange::add
+(
+	GeometricField<Type, fvPatchField, volMesh>& vf
+)
+{
+	if (&vf.mesh() != &mesh())
+	{
+		FatalErrorInFunction
+			<< "Field " << vf.name() << " is not defined on mesh "
+			<< mesh().name()
+			<< abort(FatalError);
+	}
+
+	fields_.append(new haloFieldType<Type>(vf, isProcPatch_));
+}
+
+
+// ************************************************************************* //
@@ -34,6 +34,23 @@ Description
 	Face addressing is used to make all matrix assembly
 	and solution loops vectorise.
 
+	Implicit terms may also be assembled in place, each being added
+	directly to the coefficients of a single matrix rather than being
+	constructed as a separate matrix and summed, e.g.
+	\verbatim
+		tmp<fvVectorMatrix> tUEqn
+		(
+			new fvVectorMatrix(U, dimVol*dimVelocity/dimTime)
+		);
+		fvVectorMatrix& UEqn = tUEqn.ref();
+
+		fvm::addDdt(UEqn, U);
+		fvm::addDiv(UEqn, phi, U);
+		fvm::addLaplacian(UEqn, -1, nu, U);
+	\endverbatim
+	Schemes without an in-place implementation fall back to assembling the
+	term separately.
+
 SourceFiles
 	fvMatrix.C
 	fvMatrixSolve.C
@@ -414,6 +431,11 @@ namespace tnbLib
 		//  Use the given solver controls
 		SolverPerformance<Type> solveCoupled(const dictionary&);
 
+		//- Solve all the components together in a single pass over the
+		//  shared matrix coefficients returning the solution statistics.
+		//  Use the given solver controls
+		SolverPerformance<Type> solveMultiComponent(const dictionary&);
+
 		//- Solve segregated or coupled returning the solution statistics.
 		//  Solver controls read from fvSolution
 		SolverPerformance<Type> solve(const word& name);
@@ -564,6 +586,17 @@ namespace tnbLib
 		const char*
 	);
 
+	//- Check that a term in psi with the given dimensions can be added
+	//  in place to the matrix
+	template<class Type>
+	void checkMethod
+	(
+		const fvMatrix<Type>&,
+		const GeometricField<Type, fvPatchField, volMesh>& psi,
+		const dimensionSet&,
+		const char*
+	);
+
 
 	//- Solve returning the solution statistics given convergence tolerance
 	//  Use the given solver controls
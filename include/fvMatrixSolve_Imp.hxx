@@ -1,6 +1,8 @@
 #pragma once
 #include <LduMatrixTemplate.hxx>
 #include <ResidualsTemplate.hxx>
+#include <MultiComponentSolverTemplate.hxx>
+#include <SoAField.hxx>
 
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
@@ -61,13 +63,18 @@ tnbLib::SolverPerformance<Type> tnbLib::fvMatrix<Type>::solve
 	{
 		return solveCoupled(solverControls);
 	}
+	else if (type == "multiComponent")
+	{
+		return solveMultiComponent(solverControls);
+	}
 	else
 	{
 		FatalIOErrorInFunction
 		(
 			solverControls
 		) << "Unknown type " << type
-			<< "; currently supported solver types are segregated and coupled"
+			<< "; currently supported solver types are segregated, coupled"
+			" and multiComponent"
 			<< exit(FatalIOError);
 
 		return SolverPerformance<Type>();
@@ -113,16 +120,19 @@ tnbLib::SolverPerformance<Type> tnbLib::fvMatrix<Type>::solveSegregated
 		psi.mesh().template validComponents<Type>()
 	);
 
+	// Transpose the field and source into component fields once rather than
+	// extracting and replacing each component with a strided copy
+	SoAField<Type> psiCmpts(psi.primitiveField());
+	SoAField<Type> sourceCmpts(source);
+
 	for (direction cmpt = 0; cmpt < Type::nComponents; cmpt++)
 	{
 		if (validComponents[cmpt] == -1) continue;
 
-		// copy field and source
-
-		scalarField psiCmpt(psi.primitiveField().component(cmpt));
+		scalarField& psiCmpt = psiCmpts.component(cmpt);
 		addBoundaryDiag(diag(), cmpt);
 
-		scalarField sourceCmpt(source.component(cmpt));
+		scalarField& sourceCmpt = sourceCmpts.component(cmpt);
 
 		FieldField<Field, scalar> bouCoeffsCmpt
 		(
@@ -179,10 +189,136 @@ tnbLib::SolverPerformance<Type> tnbLib::fvMatrix<Type>::solveSegregated
 		solverPerfVec.replace(cmpt, solverPerf);
 		solverPerfVec.solverName() = solverPerf.solverName();
 
-		psi.primitiveFieldRef().replace(cmpt, psiCmpt);
 		diag() = saveDiag;
 	}
 
+	psiCmpts.scatter(psi.primitiveFieldRef());
+
+	psi.correctBoundaryConditions();
+
+	Residuals<Type>::append(psi.mesh(), solverPerfVec);
+
+	return solverPerfVec;
+}
+
+
+template<class Type>
+tnbLib::SolverPerformance<Type> tnbLib::fvMatrix<Type>::solveMultiComponent
+(
+	const dictionary& solverControls
+)
+{
+	if (debug)
+	{
+		Info.masterStream(this->mesh().comm())
+			<< "fvMatrix<Type>::solveMultiComponent"
+			"(const dictionary& solverControls) : "
+			"solving fvMatrix<Type>"
+			<< endl;
+	}
+
+	GeometricField<Type, fvPatchField, volMesh>& psi =
+		const_cast<GeometricField<Type, fvPatchField, volMesh>&>(psi_);
+
+	SolverPerformance<Type> solverPerfVec
+	(
+		"fvMatrix<Type>::solveMultiComponent",
+		psi.name()
+	);
+
+	Field<Type> source(source_);
+
+	// At this point include the boundary source from the coupled boundaries.
+	// This is corrected for the implict part by updateMatrixInterfaces within
+	// the component loop.
+	addBoundarySource(source);
+
+	typename Type::labelType validComponents
+	(
+		psi.mesh().template validComponents<Type>()
+	);
+
+	lduInterfaceFieldPtrsList interfaces =
+		psi.boundaryField().scalarInterfaces();
+
+	// The components share the off-diagonal coefficients of this matrix,
+	// only the diagonal and the boundary coefficients are held per component
+	SoAField<Type> diagCmpts(psi.size());
+	PtrList<FieldField<Field, scalar>> bouCoeffsCmpts(Type::nComponents);
+
+	const SoAField<Type> psiCmpts(psi.primitiveField());
+	SoAField<Type> sourceCmpts(source);
+
+	for (direction cmpt = 0; cmpt < Type::nComponents; cmpt++)
+	{
+		scalarField& diagCmpt = diagCmpts.component(cmpt);
+		diagCmpt = diag();
+		addBoundaryDiag(diagCmpt, cmpt);
+
+		bouCoeffsCmpts.set
+		(
+			cmpt,
+			new FieldField<Field, scalar>(boundaryCoeffs_.component(cmpt))
+		);
+
+		if (validComponents[cmpt] == -1) continue;
+
+		const scalarField& psiCmpt = psiCmpts.component(cmpt);
+		scalarField& sourceCmpt = sourceCmpts.component(cmpt);
+
+		// Use the initMatrixInterfaces and updateMatrixInterfaces to correct
+		// the source for the explicit part of the coupled boundary conditions
+		initMatrixInterfaces
+		(
+			bouCoeffsCmpts[cmpt],
+			interfaces,
+			psiCmpt,
+			sourceCmpt,
+			cmpt
+		);
+
+		updateMatrixInterfaces
+		(
+			bouCoeffsCmpts[cmpt],
+			interfaces,
+			psiCmpt,
+			sourceCmpt,
+			cmpt
+		);
+	}
+
+	sourceCmpts.scatter(source);
+
+	const tmp<Field<Type>> tdiagCmpts(diagCmpts.field());
+
+	// Solver call
+	List<solverPerformance> solverPerfs
+	(
+		MultiComponentSolver<Type>
+		(
+			psi.name(),
+			*this,
+			tdiagCmpts(),
+			bouCoeffsCmpts,
+			interfaces,
+			validComponents,
+			solverControls
+		).solve(psi.primitiveFieldRef(), source)
+	);
+
+	for (direction cmpt = 0; cmpt < Type::nComponents; cmpt++)
+	{
+		if (validComponents[cmpt] == -1) continue;
+
+		if (SolverPerformance<Type>::debug)
+		{
+			solverPerfs[cmpt].print(Info.masterStream(this->mesh().comm()));
+		}
+
+		solverPerfVec.replace(cmpt, solverPerfs[cmpt]);
+		solverPerfVec.solverName() = solverPerfs[cmpt].solverName();
+	}
+
 	psi.correctBoundaryConditions();
 
 	Residuals<Type>::append(psi.mesh(), solverPerfVec);
@@ -42,6 +42,13 @@ Description
 	motion).  It is therefore unsafe to keep local references to the
 	derived data outside of the time loop.
 
+	The internal faces are stored in their on-disk order. If the
+	"cacheBlockSize" optimisation switch is set a cache-blocked traversal
+	order of the internal faces is calculated when the mesh is loaded and
+	used by the face-to-cell loops of the discretisation. The faces are not
+	renumbered, so this is off by default and only worth setting where
+	Test-cacheBlock shows a gain, see lduAddressing.
+
 SourceFiles
 	fvMesh.C
 	fvMeshGeometry.C
@@ -293,6 +300,14 @@ namespace tnbLib
 			return lduAddr().upperAddr();
 		}
 
+		//- Internal faces in cache-blocked order for the loops scattering
+		//  face values to the cells, empty if the original order is kept,
+		//  see lduAddressing
+		const labelUList& cacheBlockFaceOrder() const
+		{
+			return lduAddr().cacheBlockFaceOrder();
+		}
+
 		//- Return cell volumes
 		FoamFiniteVolume_EXPORT const DimensionedField<scalar, volMesh>& V() const;
 
@@ -29,7 +29,8 @@ InNamespace
 	tnbLib::fvm
 
 Description
-	Calculate the matrix for the first temporal derivative.
+	Calculate the matrix for the first temporal derivative
+	or add it in place to an existing matrix.
 
 SourceFiles
 	fvmDdt.C
@@ -109,6 +110,26 @@ namespace tnbLib
 			const one&,
 			const GeometricField<Type, fvPatchField, volMesh>&
 		);
+
+
+		// In-place assembly
+
+		//- Add ddt(vf) to the given matrix
+		template<class Type>
+		void addDdt
+		(
+			fvMatrix<Type>&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
+
+		//- Add ddt(rho, vf) to the given matrix
+		template<class Type>
+		void addDdt
+		(
+			fvMatrix<Type>&,
+			const volScalarField&,
+			const GeometricField<Type, fvPatchField, volMesh>&
+		);
 	}
 
 
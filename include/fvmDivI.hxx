@@ -72,6 +72,40 @@ namespace tnbLib
 		}
 
 
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+		template<class Type>
+		void addDiv
+		(
+			fvMatrix<Type>& fvm,
+			const surfaceScalarField& flux,
+			const GeometricField<Type, fvPatchField, volMesh>& vf,
+			const word& name
+		)
+		{
+			checkMethod(fvm, vf, flux.dimensions()*vf.dimensions(), "addDiv");
+
+			fv::convectionScheme<Type>::New
+			(
+				vf.mesh(),
+				flux,
+				vf.mesh().divScheme(name)
+			)().addFvmDiv(fvm, 1, flux, vf);
+		}
+
+
+		template<class Type>
+		void addDiv
+		(
+			fvMatrix<Type>& fvm,
+			const surfaceScalarField& flux,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			fvm::addDiv(fvm, flux, vf, "div(" + flux.name() + ',' + vf.name() + ')');
+		}
+
+
 		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 	} // End namespace fvm
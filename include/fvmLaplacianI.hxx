@@ -307,6 +307,126 @@ namespace tnbLib
 		}
 
 
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const dimensioned<GType>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			const GeometricField<GType, fvsPatchField, surfaceMesh> Gamma
+			(
+				IOobject
+				(
+					gamma.name(),
+					vf.instance(),
+					vf.mesh(),
+					IOobject::NO_READ
+				),
+				vf.mesh(),
+				gamma
+			);
+
+			fvm::addLaplacian(fvm, coeff, Gamma, vf);
+		}
+
+
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvPatchField, volMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf,
+			const word& name
+		)
+		{
+			checkMethod
+			(
+				fvm,
+				vf,
+				gamma.dimensions()*dimLength*vf.dimensions(),
+				"addLaplacian"
+			);
+
+			fv::template laplacianScheme<Type, GType>::New
+			(
+				vf.mesh(),
+				vf.mesh().laplacianScheme(name)
+			).ref().addFvmLaplacian(fvm, coeff, gamma, vf);
+		}
+
+
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvPatchField, volMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			fvm::addLaplacian
+			(
+				fvm,
+				coeff,
+				gamma,
+				vf,
+				"laplacian(" + gamma.name() + ',' + vf.name() + ')'
+			);
+		}
+
+
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf,
+			const word& name
+		)
+		{
+			checkMethod
+			(
+				fvm,
+				vf,
+				gamma.dimensions()*dimLength*vf.dimensions(),
+				"addLaplacian"
+			);
+
+			fv::template laplacianScheme<Type, GType>::New
+			(
+				vf.mesh(),
+				vf.mesh().laplacianScheme(name)
+			).ref().addFvmLaplacian(fvm, coeff, gamma, vf);
+		}
+
+
+		template<class Type, class GType>
+		void addLaplacian
+		(
+			fvMatrix<Type>& fvm,
+			const scalar coeff,
+			const GeometricField<GType, fvsPatchField, surfaceMesh>& gamma,
+			const GeometricField<Type, fvPatchField, volMesh>& vf
+		)
+		{
+			fvm::addLaplacian
+			(
+				fvm,
+				coeff,
+				gamma,
+				vf,
+				"laplacian(" + gamma.name() + ',' + vf.name() + ')'
+			);
+		}
+
+
 		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 	} // End namespace fvm
@@ -57,12 +57,31 @@ tnbLib::fv::gaussGrad<Type>::gradf
 	Field<GradType>& igGrad = gGrad;
 	const Field<Type>& issf = ssf;
 
-	forAll(owner, facei)
+	// Traverse the faces in cache-blocked order, if set, for locality of the
+	// cells
+	const labelUList& faceOrder = mesh.cacheBlockFaceOrder();
+
+	if (faceOrder.size())
 	{
-		GradType Sfssf = Sf[facei] * issf[facei];
+		forAll(faceOrder, i)
+		{
+			const label facei = faceOrder[i];
+
+			GradType Sfssf = Sf[facei] * issf[facei];
 
-		igGrad[owner[facei]] += Sfssf;
-		igGrad[neighbour[facei]] -= Sfssf;
+			igGrad[owner[facei]] += Sfssf;
+			igGrad[neighbour[facei]] -= Sfssf;
+		}
+	}
+	else
+	{
+		forAll(owner, facei)
+		{
+			GradType Sfssf = Sf[facei] * issf[facei];
+
+			igGrad[owner[facei]] += Sfssf;
+			igGrad[neighbour[facei]] -= Sfssf;
+		}
 	}
 
 	forAll(mesh.boundary(), patchi)
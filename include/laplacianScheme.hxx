@@ -243,6 +243,24 @@ namespace tnbLib
 				const GeometricField<Type, fvPatchField, volMesh>&
 			);
 
+			//- Add coeff*fvmLaplacian(gamma, vf) to the given matrix in place.
+			//  The default implementation assembles the term separately
+			virtual void addFvmLaplacian
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const GeometricField<GType, fvsPatchField, surfaceMesh>&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
+			virtual void addFvmLaplacian
+			(
+				fvMatrix<Type>&,
+				const scalar coeff,
+				const GeometricField<GType, fvPatchField, volMesh>&,
+				const GeometricField<Type, fvPatchField, volMesh>&
+			);
+
 			virtual tmp<GeometricField<Type, fvPatchField, volMesh>> fvcLaplacian
 			(
 				const GeometricField<Type, fvPatchField, volMesh>&
@@ -0,0 +1,169 @@
+#pragma once
+#ifndef _lduLevelSchedule_Header
+#define _lduLevelSchedule_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::lduLevelSchedule
+
+Description
+	Level schedule of the triangular sweeps over a given lduAddressing.
+
+	In the forward sweep of an incomplete factorisation, e.g. of the DIC
+	and DILU preconditioners, the row of a cell depends on the rows of its
+	lower neighbours; in the backward sweep on the rows of its upper
+	neighbours. The cells are grouped into levels such that the cells of a
+	level only depend on the cells of the preceding levels, so the rows of
+	each level can be evaluated in parallel. Evaluating the rows of a cell
+	in the original face order gives results identical to the serial
+	sweeps.
+
+	The schedule only depends on the mesh topology and is cached by
+	lduAddressing.
+
+SourceFiles
+	lduLevelSchedule.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <labelList.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class lduAddressing;
+
+	/*---------------------------------------------------------------------------*\
+							   Class lduLevelSchedule Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class lduLevelSchedule
+	{
+		// Private Data
+
+			//- Cells of the forward sweep ordered by level
+		labelList lowerCells_;
+
+		//- Start of each level of the forward sweep. Size is nLevels + 1.
+		labelList lowerLevelStart_;
+
+		//- Cells of the backward sweep ordered by level
+		labelList upperCells_;
+
+		//- Start of each level of the backward sweep. Size is nLevels + 1.
+		labelList upperLevelStart_;
+
+
+		// Private Member Functions
+
+			//- Sort the cells by level into cells and levelStart
+		static void sortByLevel
+		(
+			const labelList& level,
+			labelList& cells,
+			labelList& levelStart
+		);
+
+		//- Apply rowOp to the cells of each level in turn,
+		//  to the cells of a level in parallel
+		template<class RowOp>
+		static void sweep
+		(
+			const labelList& cells,
+			const labelList& levelStart,
+			const RowOp& rowOp
+		);
+
+
+	public:
+
+		// Static Data
+
+			//- Minimum number of cells per thread block within a level
+		static FoamBase_EXPORT const label minLevelBlockSize;
+
+
+		// Constructors
+
+			//- Construct from LDU addressing
+		FoamBase_EXPORT lduLevelSchedule(const lduAddressing&);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT lduLevelSchedule(const lduLevelSchedule&) = delete;
+
+
+		// Member Functions
+
+			//- Return the number of levels of the forward sweep
+		label nLowerLevels() const
+		{
+			return lowerLevelStart_.size() - 1;
+		}
+
+		//- Return the number of levels of the backward sweep
+		label nUpperLevels() const
+		{
+			return upperLevelStart_.size() - 1;
+		}
+
+		//- Apply rowOp(celli) to all the cells in the order of the forward
+		//  sweep, the cells of each level in parallel
+		template<class RowOp>
+		void forwardSweep(const RowOp& rowOp) const
+		{
+			sweep(lowerCells_, lowerLevelStart_, rowOp);
+		}
+
+		//- Apply rowOp(celli) to all the cells in the order of the backward
+		//  sweep, the cells of each level in parallel
+		template<class RowOp>
+		void backwardSweep(const RowOp& rowOp) const
+		{
+			sweep(upperCells_, upperLevelStart_, rowOp);
+		}
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const lduLevelSchedule&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#include <lduLevelScheduleI.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_lduLevelSchedule_Header
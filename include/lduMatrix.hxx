@@ -39,6 +39,11 @@ Description
 	from an empty matrix, then deriving diagonal, symmetric and asymmetric
 	matrices.
 
+	A compressed sparse row copy of the coefficients may be cached for the
+	matrix-vector product and residual evaluation, see lduCSRMatrix. It is
+	selected by the "matrixFormat" solver control and is cleared whenever
+	the coefficients are accessed for modification.
+
 SourceFiles
 	lduMatrixATmul.C
 	lduMatrix.C
@@ -71,6 +76,7 @@ namespace tnbLib
 	// Forward declaration of friend functions and operators
 
 	class lduMatrix;
+	class lduCSRMatrix;
 
 	FoamBase_EXPORT Ostream& operator<<(Ostream&, const lduMatrix&);
 	FoamBase_EXPORT Ostream& operator<<(Ostream&, const InfoProxy<lduMatrix>&);
@@ -90,6 +96,40 @@ namespace tnbLib
 		//- Coefficients (not including interfaces)
 		scalarField *lowerPtr_, *diagPtr_, *upperPtr_;
 
+		//- Cached compressed sparse row copy of the coefficients
+		mutable lduCSRMatrix* csrPtr_;
+
+		//- Number of outstanding requests before the interface update was
+		//  initialised. Requests started earlier, e.g. non-blocking
+		//  reductions of the solver, are left in flight.
+		mutable label interfaceStartRequest_;
+
+		//- Number of interior faces evaluated between polls of the
+		//  processor interfaces
+		static FoamBase_EXPORT const label interfacePollSize_;
+
+
+		// Private Member Functions
+
+			//- Return the processor patches the exchange of which is to be
+			//  overlapped with the evaluation of the interior rows. Empty if
+			//  not running in parallel with non-blocking communication.
+		FoamBase_EXPORT boolList overlapPatches
+		(
+			const lduInterfaceFieldPtrsList& interfaces
+		) const;
+
+		//- Consume the processor interfaces the values of which have been
+		//  received, without waiting for the others
+		FoamBase_EXPORT void pollMatrixInterfaces
+		(
+			const FieldField<Field, scalar>& interfaceCoeffs,
+			const lduInterfaceFieldPtrsList& interfaces,
+			const scalarField& psiif,
+			scalarField& result,
+			const direction cmpt
+		) const;
+
 
 	public:
 
@@ -391,6 +431,20 @@ namespace tnbLib
 				const scalarField& Apsi,
 				scalarField& tmpField
 			) const;
+
+			//- Return the sum of the magnitude of the residual field rA
+			//  normalised by the matrix norm, which is returned in
+			//  normFactor. The reductions of the norm and of the residual
+			//  are batched and overlapped with the computation of A.1
+			FoamBase_EXPORT scalar normalisedResidual
+			(
+				const scalarField& psi,
+				const scalarField& source,
+				const scalarField& Apsi,
+				const scalarField& rA,
+				scalarField& tmpField,
+				scalar& normFactor
+			) const;
 		};
 
 
@@ -957,6 +1011,22 @@ namespace tnbLib
 		}
 
 
+		// Compressed sparse row format
+
+			//- Return the compressed sparse row copy of the coefficients,
+			//  constructing it if not cached
+		FoamBase_EXPORT const lduCSRMatrix& csr() const;
+
+		//- Return true if the compressed sparse row copy is cached
+		bool hasCSR() const
+		{
+			return (csrPtr_);
+		}
+
+		//- Clear the cached compressed sparse row copy
+		FoamBase_EXPORT void clearCSR() const;
+
+
 		// operations
 
 		FoamBase_EXPORT void sumDiag();
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef _listPool_Header
+#define _listPool_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Class
+	tnbLib::listPool
+
+Description
+	Pool of the storage blocks of the Lists of trivially destructible
+	types, e.g. the scalar, vector and label Lists and Fields.
+
+	The storage of the many temporary fields of the same sizes (number of
+	cells, faces, patch faces) created and destroyed each time step is
+	recycled by exact block size instead of being returned to the system
+	allocator, avoiding the allocator and page-fault overhead and reusing
+	memory that has already been touched by the running threads.
+
+	The pool is enabled at compile time by defining USELISTPOOL, in which
+	case List allocates the storage of these types through it. Each
+	block carries a small header holding its size so that it can be
+	recycled irrespective of the size the List reports on release, e.g. by
+	DynamicList. Blocks smaller than minBlockSize bytes are not recycled,
+	at most maxFreeBlocks blocks of each size are kept and blocks are
+	returned to the system allocator once the free blocks of all sizes
+	total maxFreeBytes, so that the pool does not grow with the number of
+	distinct sizes. The free blocks are released when a mesh is destroyed,
+	since they were sized for its fields, and at the end of the run.
+
+	The numbers of hits (allocations served from the pool) and misses of
+	each block size are written at the end of the run.
+
+SourceFiles
+	listPool.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <label.hxx>
+
+#include <cstddef>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	// Forward declaration of classes
+	class Ostream;
+
+	/*---------------------------------------------------------------------------*\
+							   Class listPool Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class listPool
+	{
+	public:
+
+		// Static Data
+
+			//- Size of the block header, preserving the alignment
+		static const size_t headerSize = 16;
+
+		//- Minimum size in bytes of the recycled blocks
+		static FoamBase_EXPORT const size_t minBlockSize;
+
+		//- Maximum number of free blocks kept for each block size
+		static FoamBase_EXPORT const label maxFreeBlocks;
+
+		//- Maximum total size in bytes of the free blocks kept
+		static FoamBase_EXPORT const size_t maxFreeBytes;
+
+
+		// Static Member Functions
+
+			//- Return storage of the given size in bytes
+		static FoamBase_EXPORT void* allocate(const size_t nBytes);
+
+		//- Return the storage obtained from allocate to the pool
+		static FoamBase_EXPORT void deallocate(void* ptr);
+
+		//- Release the free blocks to the system
+		static FoamBase_EXPORT void clear();
+
+		//- Return true if storage has been allocated through the pool
+		static FoamBase_EXPORT bool used();
+
+		//- Write the hit and miss statistics of each block size
+		static FoamBase_EXPORT void writeStatistics(Ostream&);
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_listPool_Header
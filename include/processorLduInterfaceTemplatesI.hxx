@@ -13,7 +13,47 @@ void tnbLib::processorLduInterface::send
 {
 	label nBytes = f.byteSize();
 
-	if
+	if (sharedMemory())
+	{
+		// Copy into the shared-memory window, read by the neighbour's
+		// receive
+		if
+			(
+				UOPstream::writeShared
+				(
+					neighbProcNo(),
+					reinterpret_cast<const char*>(f.begin()),
+					nBytes,
+					tag(),
+					comm()
+				)
+				)
+		{
+			return;
+		}
+
+		// No space in the window. Send by MPI, the neighbour's receive
+		// reads the message directly
+		const char* buf = reinterpret_cast<const char*>(f.begin());
+
+		if (commsType == Pstream::commsTypes::nonBlocking)
+		{
+			resizeBuf(sendBuf_, nBytes);
+			memcpy(sendBuf_.begin(), f.begin(), nBytes);
+			buf = sendBuf_.begin();
+		}
+
+		OPstream::write
+		(
+			commsType,
+			neighbProcNo(),
+			buf,
+			nBytes,
+			tag(),
+			comm()
+		);
+	}
+	else if
 		(
 			commsType == Pstream::commsTypes::blocking
 			|| commsType == Pstream::commsTypes::scheduled
@@ -72,7 +112,32 @@ void tnbLib::processorLduInterface::receive
 	UList<Type>& f
 ) const
 {
-	if
+	if (sharedMemory())
+	{
+		if
+			(
+				!UIPstream::readShared
+				(
+					neighbProcNo(),
+					reinterpret_cast<char*>(f.begin()),
+					f.byteSize(),
+					tag(),
+					comm()
+				)
+				)
+		{
+			IPstream::read
+			(
+				Pstream::commsTypes::scheduled,
+				neighbProcNo(),
+				reinterpret_cast<char*>(f.begin()),
+				f.byteSize(),
+				tag(),
+				comm()
+			);
+		}
+	}
+	else if
 		(
 			commsType == Pstream::commsTypes::blocking
 			|| commsType == Pstream::commsTypes::scheduled
@@ -121,7 +186,13 @@ void tnbLib::processorLduInterface::compressedSend
 	const UList<Type>& f
 ) const
 {
-	if (sizeof(scalar) != sizeof(float) && Pstream::floatTransfer && f.size())
+	if
+		(
+			sizeof(scalar) != sizeof(float)
+			&& Pstream::floatTransfer
+			&& f.size()
+			&& !sharedMemory()
+			)
 	{
 		static const label nCmpts = sizeof(Type) / sizeof(scalar);
 		label nm1 = (f.size() - 1)*nCmpts;
@@ -201,7 +272,13 @@ void tnbLib::processorLduInterface::compressedReceive
 	UList<Type>& f
 ) const
 {
-	if (sizeof(scalar) != sizeof(float) && Pstream::floatTransfer && f.size())
+	if
+		(
+			sizeof(scalar) != sizeof(float)
+			&& Pstream::floatTransfer
+			&& f.size()
+			&& !sharedMemory()
+			)
 	{
 		static const label nCmpts = sizeof(Type) / sizeof(scalar);
 		label nm1 = (f.size() - 1)*nCmpts;
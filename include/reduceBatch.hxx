@@ -0,0 +1,223 @@
+#pragma once
+#ifndef _reduceBatch_Header
+#define _reduceBatch_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::reduceBatch
+
+Description
+	Batch of global scalar reductions started together and completed
+	without blocking the caller.
+
+	The local contributions are collected with sum(), min() and max(), each
+	returning a future for the global value. start() posts all the sums as
+	one non-blocking reduction and all the minima and maxima as another, so
+	that both are in flight together and independent work can be done before
+	the results are needed. The first access to a result waits for the
+	reductions to complete, starting them if necessary.
+
+	The reductions are removed from the list of outstanding requests when
+	they are completed, as long as the requests posted after start() have
+	been completed first, e.g. those of an interface update done while the
+	batch is in flight. A batch which is started and then immediately
+	waited for does not overlap anything; it only merges the reductions
+	into two messages.
+
+	\verbatim
+		reduceBatch batch(mesh.comm());
+
+		const reduceBatch::future sumV = batch.sum(sum(V));
+		const reduceBatch::future maxCo = batch.max(max(Co));
+
+		batch.start();
+
+		...
+
+		const scalar meanCo = ... /sumV.value();
+	\endverbatim
+
+	In serial the local values are returned unchanged.
+
+SourceFiles
+	reduceBatch.C
+
+\*---------------------------------------------------------------------------*/
+
+#include <UPstream.hxx>
+#include <DynamicList.hxx>
+#include <scalar.hxx>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class reduceBatch Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class reduceBatch
+	{
+	public:
+
+		//- Handle to the global value of one reduction of the batch
+		class future
+		{
+		public:
+
+			//- Reduction operation
+			enum operation { SUM, MIN, MAX };
+
+
+		private:
+
+			// Private Data
+
+				//- Batch the reduction belongs to
+			reduceBatch* batchPtr_;
+
+			//- Operation
+			operation op_;
+
+			//- Index in the list of sums or minima of the batch
+			label index_;
+
+
+		public:
+
+			// Constructors
+
+				//- Construct from components
+			future(reduceBatch& batch, const operation op, const label index)
+				:
+				batchPtr_(&batch),
+				op_(op),
+				index_(index)
+			{}
+
+
+			// Member Functions
+
+				//- Return the global value, waiting for the batch to complete
+			FoamBase_EXPORT scalar value() const;
+		};
+
+
+	private:
+
+		// Private Data
+
+			//- Communicator
+		const label comm_;
+
+		//- Message tag
+		const int tag_;
+
+		//- Values to be summed, reduced in place
+		DynamicList<scalar> sums_;
+
+		//- Values to be minimised, reduced in place. Maxima are stored
+		//  negated so that they are combined in the same reduction
+		DynamicList<scalar> mins_;
+
+		//- Request of the reduction of the sums, -1 if none outstanding
+		label sumRequest_;
+
+		//- Request of the reduction of the minima, -1 if none outstanding
+		label minRequest_;
+
+		//- Number of outstanding requests before the reductions were posted
+		label startRequest_;
+
+		//- Whether the reductions have been started
+		bool started_;
+
+
+		// Private Member Functions
+
+			//- Check that no value is added after start
+		FoamBase_EXPORT void checkNotStarted() const;
+
+		//- Complete the outstanding reductions and, if no request was
+		//  posted after them, remove them from the outstanding requests
+		FoamBase_EXPORT void waitForRequests();
+
+
+	public:
+
+		// Constructors
+
+			//- Construct for the given communicator
+		FoamBase_EXPORT explicit reduceBatch
+		(
+			const label comm = UPstream::worldComm,
+			const int tag = UPstream::msgType()
+		);
+
+		//- Disallow default bitwise copy construction
+		FoamBase_EXPORT reduceBatch(const reduceBatch&) = delete;
+
+
+		//- Destructor, waits for outstanding reductions
+		FoamBase_EXPORT ~reduceBatch();
+
+
+		// Member Functions
+
+			//- Add a local value to be summed
+		FoamBase_EXPORT future sum(const scalar localValue);
+
+		//- Add a local value to be minimised
+		FoamBase_EXPORT future min(const scalar localValue);
+
+		//- Add a local value to be maximised
+		FoamBase_EXPORT future max(const scalar localValue);
+
+		//- Start the reductions without waiting for them to complete
+		FoamBase_EXPORT void start();
+
+		//- Return true if the reductions have been started and completed.
+		//  Does not wait
+		FoamBase_EXPORT bool finished() const;
+
+		//- Wait for the reductions to complete, starting them if necessary
+		FoamBase_EXPORT void wait();
+
+
+		// Member Operators
+
+			//- Disallow default bitwise assignment
+		FoamBase_EXPORT void operator=(const reduceBatch&) = delete;
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_reduceBatch_Header
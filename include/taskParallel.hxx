@@ -0,0 +1,173 @@
+#pragma once
+#ifndef _taskParallel_Header
+#define _taskParallel_Header
+
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     | Website:  https://openfoam.org
+	\\  /    A nd           | Copyright (C) 2011-2019 OpenFOAM Foundation
+	 \\/     M anipulation  |
+-------------------------------------------------------------------------------
+License
+	This file is part of OpenFOAM.
+
+	OpenFOAM is free software: you can redistribute it and/or modify it
+	under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+	ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+	FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+	for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+	tnbLib::taskParallel
+
+Description
+	Concurrent execution of independent coarse-grained tasks, e.g. the
+	assembly and solution of the equations of the species in a
+	multi-component solver, on the threads of the global threadPool.
+
+	The tasks are only run concurrently if
+	- more than one thread is selected with the "nThreads" switch,
+	- the code is compiled with USEATOMICREFCOUNT so that tmp and refCount
+	  can be shared between threads,
+	- the run is not parallel, since each task may call reductions which
+	  have to be issued in the same order on all processors,
+	- the call is not made from within another task.
+	Otherwise the tasks are executed in order by the calling thread.
+
+	The tasks have to obey the following rules:
+	- demand-driven data shared between the tasks, e.g. the mesh geometry,
+	  the addressing and the interpolation weights, must be evaluated
+	  before the tasks are started,
+	- objects constructed within a task are not registered with their
+	  objectRegistry unless explicitly stored, so temporary fields of
+	  different tasks do not clash,
+	- a task may only modify the fields it owns.
+	Check-in and check-out of the objectRegistry, the collection of the
+	solver residuals and the solver performance output are serialised with
+	sharedLock. So are the demand-driven lduAddressing data and the
+	construction of mesh objects by MeshObject::New and
+	GAMGAgglomeration::New, which may therefore be first requested within
+	a task.
+
+	\verbatim
+		// Evaluate the shared demand-driven data
+		mesh.deltaCoeffs();
+		mesh.weights();
+
+		taskParallel::run
+		(
+			Y.size(),
+			[&](const label i)
+			{
+				volScalarField& Yi = Y[i];
+
+				fvScalarMatrix YiEqn
+				(
+					fvm::ddt(rho, Yi)
+				  + fvm::div(phi, Yi)
+				  - fvm::laplacian(DEff, Yi)
+				 ==
+					reaction->R(Yi)
+				);
+
+				YiEqn.solve("Yi");
+			}
+		);
+	\endverbatim
+
+SourceFiles
+	taskParallel.cxx
+
+\*---------------------------------------------------------------------------*/
+
+#include <threadPool.hxx>
+
+#include <mutex>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace tnbLib
+{
+
+	/*---------------------------------------------------------------------------*\
+							   Class taskParallel Declaration
+	\*---------------------------------------------------------------------------*/
+
+	class taskParallel
+	{
+		// Private Static Data
+
+			//- Mutex serialising the updates of shared data from the tasks
+		static FoamBase_EXPORT std::recursive_mutex mutex_;
+
+
+	public:
+
+		// Public Classes
+
+			//- Scoped lock of the shared data, only taken within a task
+		class sharedLock
+		{
+			// Private Data
+
+				//- Lock, owning the mutex only if constructed within a task
+			std::unique_lock<std::recursive_mutex> lock_;
+
+
+		public:
+
+			// Constructors
+
+				//- Lock the shared data if called from within a task
+			sharedLock()
+				:
+				lock_(mutex_, std::defer_lock)
+			{
+				if (threadPool::inTask())
+				{
+					lock_.lock();
+				}
+			}
+
+			//- Disallow default bitwise copy construction
+			sharedLock(const sharedLock&) = delete;
+
+
+			// Member Operators
+
+				//- Disallow default bitwise assignment
+			void operator=(const sharedLock&) = delete;
+		};
+
+
+		// Static Member Functions
+
+			//- Return true if the given number of tasks would be executed
+			//  concurrently
+		static FoamBase_EXPORT bool concurrent(const label nTasks);
+
+		//- Execute body(taski) for taski = 0..nTasks-1, concurrently if
+		//  possible. Returns when all tasks have finished.
+		static FoamBase_EXPORT void run
+		(
+			const label nTasks,
+			const std::function<void(const label)>& body
+		);
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace tnbLib
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // !_taskParallel_Header